@@ -1,25 +1,28 @@
 // File: algorithm.cpp
 // Author: Johnny CW
 // Date: March 24, 2025
-// Description: Implements 8-puzzle solvers (Uniform Cost and A*) with strict expanded list for WebAssembly integration.
+// Description: Implements 8-puzzle solvers (Uniform Cost and A*) with a hashed state table for WebAssembly integration.
 
 #include "algorithm.h"
-#include <set>
+#include "board.h"
+#include "statetable.h"
 #include <vector>
 #include <algorithm>
 #include <ctime>
 #include <cstdlib>
 #include <functional>
-#include <emscripten.h>
+#include <climits>
+#include "platform.h"
 
 using namespace std;
 
 
 //Represents a state in Uniform Cost Search with cost and path.
 struct Node {
-    Puzzle state;
+    packedBoard board;
     int gCost; // Cost to reach this node
     string path; // Path taken to reach this node
+    int entry; // Index of this state in the StateTable
 
     bool operator>(const Node& other) const {
         return gCost > other.gCost; // Compare based on total cost for priority queue
@@ -28,10 +31,11 @@ struct Node {
 
 //Represents a state in A* search with total cost (fCost = gCost + hCost).
 struct AStarNode {
-    Puzzle state;
+    packedBoard board;
     int gCost; // Cost to reach this node
     int fCost; // Total cost (gCost + hCost)
     string path; // Path taken to reach this node
+    int entry; // Index of this state in the StateTable
 
     bool operator>(const AStarNode& other) const {
         return fCost > other.fCost; // Compare based on total cost for priority queue
@@ -39,10 +43,137 @@ struct AStarNode {
 };
 
 
+///////////////////////////////////////////////////////////////////////////////////////////
+//
+// Open list: binary min-heap whose positions are mirrored in StateEntry::handle, so a node
+// can be found and re-prioritised in place (decrease-key) instead of being pushed twice.
+//
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// Moves heap[i] towards the root until its parent is no larger.
+template <class T>
+static void siftUp(vector<T> &heap, int i, StateTable &table){
+    T node = std::move(heap[i]);
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!(heap[parent] > node)) {
+            break;
+        }
+        heap[i] = std::move(heap[parent]);
+        table.entry(heap[i].entry).handle = i;
+        i = parent;
+    }
+    table.entry(node.entry).handle = i;
+    heap[i] = std::move(node);
+}
+
+// Moves heap[i] towards the leaves until neither child is smaller.
+template <class T>
+static void siftDown(vector<T> &heap, int i, StateTable &table){
+    int n = (int)heap.size();
+    T node = std::move(heap[i]);
+    while (2 * i + 1 < n) {
+        int child = 2 * i + 1;
+        if (child + 1 < n && heap[child] > heap[child + 1]) {
+            child++;
+        }
+        if (!(node > heap[child])) {
+            break;
+        }
+        heap[i] = std::move(heap[child]);
+        table.entry(heap[i].entry).handle = i;
+        i = child;
+    }
+    table.entry(node.entry).handle = i;
+    heap[i] = std::move(node);
+}
+
+template <class T>
+static void pushNode(vector<T> &heap, T const &node, StateTable &table){
+    heap.push_back(node);
+    siftUp(heap, (int)heap.size() - 1, table);
+}
+
+// Removes the cheapest node and marks its state as expanded.
+template <class T>
+static T popMin(vector<T> &heap, StateTable &table){
+    T top = std::move(heap.front());
+    if (heap.size() > 1) {
+        heap.front() = std::move(heap.back());
+        heap.pop_back();
+        siftDown(heap, 0, table);
+    } else {
+        heap.pop_back();
+    }
+    table.entry(top.entry).handle = StateTable::CLOSED;
+    return top;
+}
+
+// The state table for one solve. Native tools run many solves per thread (solverd workers, the generator),
+// so each thread keeps one table and clears it between solves; the browser build owns a table per call and
+// gives its memory back when the call returns.
+#ifdef __EMSCRIPTEN__
+struct SolveTable {
+    StateTable table;
+};
+#else
+struct SolveTable {
+    StateTable &table;
+
+    SolveTable() : table(perThread()) {
+        table.clear();
+    }
+
+    static StateTable &perThread(){
+        static thread_local StateTable shared;
+        return shared;
+    }
+};
+#endif
+
+// Heuristic on packed boards towards an arbitrary target, so frontier sub-searches can aim at relay states.
+struct PackedHeuristic {
+    int width;
+    heuristicFunction function;
+    packedBoard target;
+    int targetCell[MAX_BOARD_CELLS]; // Cell holding each tile in the target
+
+    PackedHeuristic(packedBoard t, int w, heuristicFunction f) : width(w), function(f), target(t) {
+        for (int i = 0; i < w * w; i++) {
+            targetCell[tileAt(t, i)] = i;
+        }
+    }
+
+    int operator()(packedBoard board) const {
+        int h = 0;
+        for (int i = 0; i < width * width; i++) {
+            int tile = tileAt(board, i);
+            if (tile == 0) {
+                continue;
+            }
+            if (function == misplacedTiles) {
+                h += (targetCell[tile] != i);
+            } else {
+                h += abs(i / width - targetCell[tile] / width) + abs(i % width - targetCell[tile] % width);
+            }
+        }
+        return h;
+    }
+};
+
+// Returns: True if both states are boards of the same size holding each tile exactly once
+static bool validQuery(string const initialState, string const goalState){
+    return validBoard(initialState) && validBoard(goalState) && initialState.length() == goalState.length();
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 //
 // Search Algorithm:  UC with Strict Expanded List
 //
+// Every generated state is recorded once in a StateTable holding its best gCost and open-list
+// position, so a state already waiting in the queue is never pushed a second time.
+//
 // Params:
 //   - initialState: Starting puzzle state (string, e.g., "123804765")
 //   - goalState: Target state (string, e.g., "123456780")
@@ -50,107 +181,92 @@ struct AStarNode {
 //   - numOfStateExpansions: Output for number of states explored
 //   - maxQLength: Output for maximum size of priority queue
 //   - actualRunningTime: Output for execution time in seconds
-//   - numOfDeletionsFromMiddleOfHeap: Unused (for heap optimization stats)
+//   - numOfDeletionsFromMiddleOfHeap: Output for queued nodes replaced by a cheaper path (decrease-key)
 //   - numOfLocalLoopsAvoided: Unused (for loop avoidance stats)
-//   - numOfAttemptedNodeReExpansions: Unused (for re-expansion stats)
+//   - numOfAttemptedNodeReExpansions: Output for successors rejected because they were already expanded
+//   - maxExpansions: Give up (returning empty) if the goal is not reached within this many expansions; 0 means no limit
 //
 // Returns: String of moves (e.g., "UDLR") or empty if unsolvable
 //
 ////////////////////////////////////////////////////////////////////////////////////////////
 string uc_explist(string const initialState, string const goalState, int& pathLength, int &numOfStateExpansions, int& maxQLength,
-                               float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions){
+                               float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions,
+                               int maxExpansions){
 
-    string path;
-    clock_t startTime;
+    solverTime startTime;
 
     numOfDeletionsFromMiddleOfHeap = 0;
     numOfLocalLoopsAvoided = 0;
     numOfAttemptedNodeReExpansions = 0;
 
     actualRunningTime = 0.0;
-    startTime = clock();
+    startTime = solverClock();
 
     vector<Node> heap;
-    set<string> expandedList;
+    SolveTable solveTable;
+    StateTable &table = solveTable.table;
 
-    Puzzle initialPuzzle(initialState, goalState);
-    Node startNode = {initialPuzzle, 0, ""};
+    if (!validQuery(initialState, goalState)) {
+        emscripten_log(EM_LOG_CONSOLE, "Invalid puzzle: %s -> %s", initialState.c_str(), goalState.c_str());
+        return "";
+    }
+    int width = initialState.length() == 9 ? 3 : 4;
+    packedBoard goal = packBoard(goalState);
+    Node startNode = {packBoard(initialState), 0, "", table.insert(packBoard(initialState), 0, 0)};
 
-    heap.push_back(startNode);
-    push_heap(heap.begin(), heap.end(), greater<Node>());
+    pushNode(heap, startNode, table);
 
     maxQLength = heap.size();
 
     emscripten_log(EM_LOG_CONSOLE, "UC Solver started with initial state: %s", initialState.c_str());
     while (!heap.empty()) {
-        pop_heap(heap.begin(), heap.end(), greater<Node>());
-        Node currentNode = heap.back();
-        heap.pop_back();
+        Node currentNode = popMin(heap, table);
 
         // Goal check
-        if (currentNode.state.goalMatch()) {
+        if (currentNode.board == goal) {
             pathLength = currentNode.gCost;
-            actualRunningTime = ((float)(clock() - startTime) / CLOCKS_PER_SEC);
+            actualRunningTime = secondsSince(startTime);
 
             emscripten_log(EM_LOG_CONSOLE, "Solution found! Path: %s, Length: %d, Expansions: %d, Max Queue: %d, Time: %.3f s",
                                        currentNode.path.c_str(), pathLength, numOfStateExpansions, maxQLength, actualRunningTime);
             return currentNode.path; // Immediate return upon goal match
         }
 
-        expandedList.insert(currentNode.state.toString());
+        // Checked after the goal test, so a solve that needs exactly maxExpansions expansions succeeds
+        if (maxExpansions > 0 && numOfStateExpansions >= maxExpansions) {
+            break; // Expansion budget exhausted
+        }
         numOfStateExpansions++;
 
         // Generate successors
-        vector<Puzzle> successors;
-        if (currentNode.state.canMoveUp()) {
-            Puzzle nextState = *currentNode.state.moveUp();
-            successors.push_back(nextState);
-            path = currentNode.path + "U";
-        }
-        if (currentNode.state.canMoveRight()) {
-            Puzzle nextState = *currentNode.state.moveRight();
-            successors.push_back(nextState);
-            path = currentNode.path + "R";
-        }
-        if (currentNode.state.canMoveDown()) {
-            Puzzle nextState = *currentNode.state.moveDown();
-            successors.push_back(nextState);
-            path = currentNode.path + "D";
-        }
-        if (currentNode.state.canMoveLeft()) {
-            Puzzle nextState = *currentNode.state.moveLeft();
-            successors.push_back(nextState);
-            path = currentNode.path + "L";
-        }
+        packedBoard next[4];
+        char moves[4];
+        int n = boardSuccessors(currentNode.board, width, next, moves);
+        for (int i = 0; i < n; i++) {
+            int newGCost = currentNode.gCost + 1;
+            packedBoard key = next[i];
+            int e = table.find(key);
 
-        for (Puzzle& nextState : successors) {
-            if (expandedList.find(nextState.toString()) == expandedList.end()) {
-            	string newPath = currentNode.path;  // Keep the current path
-            	if (nextState.toString() == currentNode.state.moveUp()->toString()) {
-           			newPath += "U";  // Append 'U' to the path if it is an 'Up' move
-        		} else if (nextState.toString() == currentNode.state.moveRight()->toString()) {
-            		newPath += "R";  // Append 'R' to the path if it is a 'Right' move
-        		} else if (nextState.toString() == currentNode.state.moveDown()->toString()) {
-            		newPath += "D";  // Append 'D' to the path if it is a 'Down' move
-    		    } else if (nextState.toString() == currentNode.state.moveLeft()->toString()) {
-           			newPath += "L";  // Append 'L' to the path if it is a 'Left' move
-       			}
-
-                Node successorNode = {
-                    nextState,
-                    currentNode.gCost + 1,
-                    newPath
-                };
-
-                heap.push_back(successorNode);
-                push_heap(heap.begin(), heap.end(), greater<Node>());
+            if (e < 0) {
+                Node successorNode = {key, newGCost, currentNode.path + moves[i], table.insert(key, newGCost, 0)};
+                pushNode(heap, successorNode, table);
                 maxQLength = max(maxQLength, (int)heap.size());
+            } else if (table.entry(e).handle == StateTable::CLOSED) {
+                numOfAttemptedNodeReExpansions++;
+            } else if (newGCost < table.entry(e).gCost) {
+                // Cheaper path to a queued state: update it in place
+                int handle = table.entry(e).handle;
+                table.entry(e).gCost = newGCost;
+                heap[handle].gCost = newGCost;
+                heap[handle].path = currentNode.path + moves[i];
+                siftUp(heap, handle, table);
+                numOfDeletionsFromMiddleOfHeap++;
             }
         }
     }
 
 //***********************************************************************************************************
-	actualRunningTime = ((float)(clock() - startTime)/CLOCKS_PER_SEC);
+	actualRunningTime = secondsSince(startTime);
 	emscripten_log(EM_LOG_CONSOLE, "No solution found. Expansions: %d, Max Queue: %d, Time: %.3f s",
                        numOfStateExpansions, maxQLength, actualRunningTime);
 	return ""; // Return empty string if no solution found
@@ -162,6 +278,9 @@ string uc_explist(string const initialState, string const goalState, int& pathLe
 //
 // Search Algorithm:  A* with the Strict Expanded List
 //
+// Uses the same StateTable bookkeeping as uc_explist; a cheaper path to a queued state lowers
+// its fCost in place rather than adding a duplicate node.
+//
 // Params:
 //   - initialState: Starting puzzle state (string, e.g., "123804765")
 //   - goalState: Target state (string, e.g., "123456780")
@@ -169,19 +288,20 @@ string uc_explist(string const initialState, string const goalState, int& pathLe
 //   - numOfStateExpansions: Output for number of states explored
 //   - maxQLength: Output for maximum size of priority queue
 //   - actualRunningTime: Output for execution time in seconds
-//   - numOfDeletionsFromMiddleOfHeap: Unused (for heap optimization stats)
+//   - numOfDeletionsFromMiddleOfHeap: Output for queued nodes replaced by a cheaper path (decrease-key)
 //   - numOfLocalLoopsAvoided: Unused (for loop avoidance stats)
-//   - numOfAttemptedNodeReExpansions: Unused (for re-expansion stats)
+//   - numOfAttemptedNodeReExpansions: Output for successors rejected because they were already expanded
 //   - heuristic: Heuristic function (misplacedTiles or manhattanDistance)
+//   - maxExpansions: Give up (returning empty) if the goal is not reached within this many expansions; 0 means no limit
 //
 // Returns: String of moves (e.g., "UDLR") or empty if unsolvable
 //
 ////////////////////////////////////////////////////////////////////////////////////////////
 string aStar_ExpandedList(string const initialState, string const goalState, int& pathLength, int &numOfStateExpansions, int& maxQLength,
-                               float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions, heuristicFunction heuristic){
+                               float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions, heuristicFunction heuristic,
+                               int maxExpansions){
 
-   string path;
-   clock_t startTime;
+   solverTime startTime;
 
    numOfDeletionsFromMiddleOfHeap=0;
    numOfLocalLoopsAvoided=0;
@@ -189,31 +309,33 @@ string aStar_ExpandedList(string const initialState, string const goalState, int
 
 
 	actualRunningTime=0.0;
-	startTime = clock();
+	startTime = solverClock();
 
 	vector<AStarNode> heap;
-    set<string> expandedList;
+    SolveTable solveTable;
+    StateTable &table = solveTable.table;
 
-    Puzzle initialPuzzle(initialState, goalState);
-    int hCost = initialPuzzle.h(heuristic);
-    AStarNode startNode = {initialPuzzle, 0, hCost, ""};
+    if (!validQuery(initialState, goalState)) {
+        emscripten_log(EM_LOG_CONSOLE, "Invalid puzzle: %s -> %s", initialState.c_str(), goalState.c_str());
+        return "";
+    }
+    int width = initialState.length() == 9 ? 3 : 4;
+    packedBoard goal = packBoard(goalState);
+    PackedHeuristic h(goal, width, heuristic);
+    AStarNode startNode = {packBoard(initialState), 0, h(packBoard(initialState)), "", table.insert(packBoard(initialState), 0, 0)};
 
-    heap.push_back(startNode);
-    push_heap(heap.begin(), heap.end(), greater<AStarNode>());
+    pushNode(heap, startNode, table);
     maxQLength = heap.size();
 
     emscripten_log(EM_LOG_CONSOLE, "A* Solver started with initial state: %s, heuristic: %d", initialState.c_str(), heuristic);
 
     while (!heap.empty()) {
-        pop_heap(heap.begin(), heap.end(), greater<AStarNode>());
-        AStarNode currentNode = heap.back();
-        heap.pop_back();
+        AStarNode currentNode = popMin(heap, table);
 
         // Goal check
-        if (currentNode.state.goalMatch()) {
-            cout << "Goal state reached: " << currentNode.state.toString() << endl;
+        if (currentNode.board == goal) {
             pathLength = currentNode.gCost;
-            actualRunningTime = ((float)(clock() - startTime) / CLOCKS_PER_SEC);
+            actualRunningTime = secondsSince(startTime);
 
             emscripten_log(EM_LOG_CONSOLE, "Solution found! Path: %s, Length: %d, Expansions: %d, Max Queue: %d, Time: %.3f s",
                                        currentNode.path.c_str(), pathLength, numOfStateExpansions, maxQLength, actualRunningTime);
@@ -221,71 +343,376 @@ string aStar_ExpandedList(string const initialState, string const goalState, int
             return currentNode.path; // Immediate return upon goal match
         }
 
-        expandedList.insert(currentNode.state.toString());
+        if (maxExpansions > 0 && numOfStateExpansions >= maxExpansions) {
+            break; // Expansion budget exhausted
+        }
         numOfStateExpansions++;
 
         // Generate successors
-        vector<Puzzle> successors;
-        if (currentNode.state.canMoveUp()) {
-            Puzzle nextState = *currentNode.state.moveUp();
+        packedBoard next[4];
+        char moves[4];
+        int n = boardSuccessors(currentNode.board, width, next, moves);
+        for (int i = 0; i < n; i++) {
             int newGCost = currentNode.gCost + 1;
-            int newHCost = nextState.h(heuristic);
-            string newPath = currentNode.path + "U";
-            AStarNode successorNode = {nextState, newGCost, newGCost + newHCost, newPath};
+            packedBoard key = next[i];
+            int e = table.find(key);
 
-            if (expandedList.find(nextState.toString()) == expandedList.end()) {
-                heap.push_back(successorNode);
-                push_heap(heap.begin(), heap.end(), greater<AStarNode>());
+            if (e < 0) {
+                AStarNode successorNode = {key, newGCost, newGCost + h(key), currentNode.path + moves[i],
+                                           table.insert(key, newGCost, 0)};
+                pushNode(heap, successorNode, table);
                 maxQLength = max(maxQLength, (int)heap.size());
+            } else if (table.entry(e).handle == StateTable::CLOSED) {
+                numOfAttemptedNodeReExpansions++;
+            } else if (newGCost < table.entry(e).gCost) {
+                // Cheaper path to a queued state: h is unchanged, so f drops by the same amount as g
+                int handle = table.entry(e).handle;
+                table.entry(e).gCost = newGCost;
+                heap[handle].fCost -= heap[handle].gCost - newGCost;
+                heap[handle].gCost = newGCost;
+                heap[handle].path = currentNode.path + moves[i];
+                siftUp(heap, handle, table);
+                numOfDeletionsFromMiddleOfHeap++;
             }
         }
-        if (currentNode.state.canMoveRight()) {
-            Puzzle nextState = *currentNode.state.moveRight();
-            int newGCost = currentNode.gCost + 1;
-            int newHCost = nextState.h(heuristic);
-            string newPath = currentNode.path + "R";
-            AStarNode successorNode = {nextState, newGCost, newGCost + newHCost, newPath};
+    }
 
-            if (expandedList.find(nextState.toString()) == expandedList.end()) {
-                heap.push_back(successorNode);
-                push_heap(heap.begin(), heap.end(), greater<AStarNode>());
-                maxQLength = max(maxQLength, (int)heap.size());
+//***********************************************************************************************************
+	actualRunningTime = secondsSince(startTime);
+
+	emscripten_log(EM_LOG_CONSOLE, "No solution found. Expansions: %d, Max Queue: %d, Time: %.3f s",
+                       numOfStateExpansions, maxQLength, actualRunningTime);
+
+	return "";
+
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////
+//
+// Search Algorithm:  UC (breadth-first, unit move cost) from one state towards many goals
+//
+// One expansion serves every goal: states are recorded once in a StateTable, whose dense entry
+// indices key the parent/move arrays used to rebuild each path. With unit costs the first time
+// a state is generated is already optimal, so a goal is settled on generation and the search
+// stops as soon as the last goal in the start's parity class is settled. Goals of the other
+// parity are unreachable and never trigger a search of the whole space.
+//
+// Params:
+//   - initialState: Starting puzzle state (string, e.g., "123804765")
+//   - goalStates: Target states; duplicates are allowed
+//   - pathLengths: Output, one per goal: length of its solution path, or -1 if unreachable
+//   - numOfStateExpansions: Output for number of states explored
+//   - maxQLength: Output for maximum size of the FIFO queue
+//   - actualRunningTime: Output for execution time in seconds
+//
+// Returns: One string of moves per goal (e.g., "UDLR"), empty for unreachable goals
+//
+////////////////////////////////////////////////////////////////////////////////////////////
+vector<string> uc_multiGoal(string const initialState, vector<string> const &goalStates, vector<int> &pathLengths,
+                            int &numOfStateExpansions, int& maxQLength, float &actualRunningTime){
+
+    solverTime startTime = solverClock();
+    actualRunningTime = 0.0;
+
+    vector<string> paths(goalStates.size());
+    pathLengths.assign(goalStates.size(), -1);
+    if (!validBoard(initialState)) {
+        emscripten_log(EM_LOG_CONSOLE, "Invalid puzzle: %s", initialState.c_str());
+        return paths;
+    }
+
+    int width = initialState.length() == 9 ? 3 : 4;
+    packedBoard start = packBoard(initialState);
+    int startParity = boardParity(start, width);
+
+    // Goals still waiting to be reached, sorted by packed board so duplicates share a lookup
+    vector<pair<packedBoard, int> > pending;
+    for (int i = 0; i < (int)goalStates.size(); i++) {
+        packedBoard goal = packBoard(goalStates[i]);
+        if (validQuery(initialState, goalStates[i]) && boardParity(goal, width) == startParity) {
+            pending.push_back(make_pair(goal, i));
+        }
+    }
+    sort(pending.begin(), pending.end());
+    int unsettled = pending.size();
+
+    SolveTable solveTable;
+    StateTable &table = solveTable.table;
+    vector<int> parent;
+    vector<char> moveTo;
+    vector<int> queue;
+    size_t head = 0;
+
+    queue.push_back(table.insert(start, 0, 0));
+    parent.push_back(-1);
+    moveTo.push_back(0);
+    maxQLength = 1;
+
+    emscripten_log(EM_LOG_CONSOLE, "Multi-goal UC started with initial state: %s, goals: %d", initialState.c_str(), (int)goalStates.size());
+
+    // Settles every goal equal to the state at entry e, rebuilding its path from the parent links
+    auto settle = [&](int e) {
+        packedBoard key = table.entry(e).key;
+        vector<pair<packedBoard, int> >::iterator it = lower_bound(pending.begin(), pending.end(), make_pair(key, -1));
+        if (it == pending.end() || it->first != key) {
+            return;
+        }
+
+        string path;
+        for (int p = e; parent[p] >= 0; p = parent[p]) {
+            path += moveTo[p];
+        }
+        reverse(path.begin(), path.end());
+
+        for (; it != pending.end() && it->first == key; ++it) {
+            paths[it->second] = path;
+            pathLengths[it->second] = table.entry(e).gCost;
+            unsettled--;
+        }
+    };
+
+    settle(0);
+    while (unsettled > 0 && head < queue.size()) {
+        int current = queue[head++];
+        StateEntry currentEntry = table.entry(current);
+        numOfStateExpansions++;
+
+        packedBoard next[4];
+        char moves[4];
+        int n = boardSuccessors(currentEntry.key, width, next, moves);
+        for (int i = 0; i < n && unsettled > 0; i++) {
+            if (table.find(next[i]) >= 0) {
+                continue;
             }
+            int e = table.insert(next[i], currentEntry.gCost + 1, 0);
+            parent.push_back(current);
+            moveTo.push_back(moves[i]);
+            queue.push_back(e);
+            settle(e);
         }
-        if (currentNode.state.canMoveDown()) {
-            Puzzle nextState = *currentNode.state.moveDown();
-            int newGCost = currentNode.gCost + 1;
-            int newHCost = nextState.h(heuristic);
-            string newPath = currentNode.path + "D";
-            AStarNode successorNode = {nextState, newGCost, newGCost + newHCost, newPath};
+        maxQLength = max(maxQLength, (int)(queue.size() - head));
+    }
 
-            if (expandedList.find(nextState.toString()) == expandedList.end()) {
-                heap.push_back(successorNode);
-                push_heap(heap.begin(), heap.end(), greater<AStarNode>());
-                maxQLength = max(maxQLength, (int)heap.size());
+	actualRunningTime = secondsSince(startTime);
+	emscripten_log(EM_LOG_CONSOLE, "Multi-goal UC finished. Unreached goals: %d, Expansions: %d, Max Queue: %d, Time: %.3f s",
+                       (int)goalStates.size() - (int)pending.size() + unsettled, numOfStateExpansions, maxQLength, actualRunningTime);
+
+	return paths;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////
+//
+// Frontier search helpers (divide-and-conquer breadth-first heuristic search)
+//
+////////////////////////////////////////////////////////////////////////////////////////////
+
+// A state in a breadth-first layer, tagged with the ancestor it passed through at the relay depth.
+struct FrontierNode {
+    packedBoard key;
+    packedBoard relay;
+
+    bool operator<(const FrontierNode& other) const {
+        return key < other.key;
+    }
+};
+
+struct FrontierStats {
+    int expansions;
+    int maxStored;  // Largest number of states held at once (previous + current + next layer)
+    int duplicates; // Successors dropped because they were already in the previous or next layer
+    int limit;      // Expansion budget for finding the goal, 0 for none
+};
+
+// Purpose: Breadth-first search that keeps only the previous, current and next layers and prunes
+//          successors with g + h > bound. The puzzle graph is bipartite, so a successor of layer k can
+//          only already appear in layer k - 1 or k + 1.
+// Params:
+//   - relayDepth: Layer whose states are recorded as relays for their descendants
+//   - relay: Output, the relay ancestor of the goal (only meaningful if the goal lies deeper than relayDepth)
+//   - nextBound: Output, smallest pruned f value (INT_MAX if nothing was pruned)
+// Returns: Depth of the goal, or -1 if it is not reachable within bound
+static int frontierLayers(packedBoard start, packedBoard goal, int width, PackedHeuristic const &h, int bound, int relayDepth,
+                          packedBoard &relay, int &nextBound, FrontierStats &stats){
+    vector<FrontierNode> previous, current, next;
+    FrontierNode startNode = {start, start};
+    current.push_back(startNode);
+    nextBound = INT_MAX;
+
+    if (start == goal) {
+        relay = start;
+        return 0;
+    }
+
+    for (int depth = 0; !current.empty(); depth++) {
+        next.clear();
+        for (FrontierNode const &node : current) {
+            if (stats.limit > 0 && stats.expansions >= stats.limit) {
+                nextBound = INT_MAX;
+                return -1;
+            }
+            stats.expansions++;
+
+            packedBoard successors[4];
+            char moves[4];
+            int n = boardSuccessors(node.key, width, successors, moves);
+            for (int i = 0; i < n; i++) {
+                int f = depth + 1 + h(successors[i]);
+                if (f > bound) {
+                    nextBound = min(nextBound, f);
+                    continue;
+                }
+                FrontierNode child = {successors[i], depth + 1 == relayDepth ? successors[i] : node.relay};
+                if (child.key == goal) {
+                    stats.maxStored = max(stats.maxStored, (int)(previous.size() + current.size() + next.size() + 1));
+                    relay = child.relay;
+                    return depth + 1;
+                }
+                next.push_back(child);
             }
         }
-        if (currentNode.state.canMoveLeft()) {
-            Puzzle nextState = *currentNode.state.moveLeft();
-            int newGCost = currentNode.gCost + 1;
-            int newHCost = nextState.h(heuristic);
-            string newPath = currentNode.path + "L";
-            AStarNode successorNode = {nextState, newGCost, newGCost + newHCost, newPath};
 
-            if (expandedList.find(nextState.toString()) == expandedList.end()) {
-                heap.push_back(successorNode);
-                push_heap(heap.begin(), heap.end(), greater<AStarNode>());
-                maxQLength = max(maxQLength, (int)heap.size());
+        // The peak is reached here, while the new layer still holds its duplicates
+        stats.maxStored = max(stats.maxStored, (int)(previous.size() + current.size() + next.size()));
+
+        // Delayed duplicate detection: sort the new layer, collapse repeats, drop states seen one layer back
+        sort(next.begin(), next.end());
+        size_t kept = 0;
+        for (size_t i = 0; i < next.size(); i++) {
+            if ((kept > 0 && next[kept - 1].key == next[i].key) || binary_search(previous.begin(), previous.end(), next[i])) {
+                stats.duplicates++;
+                continue;
             }
+            next[kept++] = next[i];
         }
+        next.resize(kept);
+
+        previous.swap(current);
+        current.swap(next);
+        vector<FrontierNode>().swap(next); // Release the oldest layer's memory
     }
+    return -1;
+}
 
-//***********************************************************************************************************
-	actualRunningTime = ((float)(clock() - startTime)/CLOCKS_PER_SEC);
+// Purpose: Rebuilds the moves between two states whose optimal distance is known, by finding the relay
+//          state halfway along and solving both halves recursively.
+static string frontierPath(packedBoard start, packedBoard goal, int width, heuristicFunction heuristic, int distance, FrontierStats &stats){
+    if (distance == 0) {
+        return "";
+    }
+    if (distance == 1) {
+        packedBoard successors[4];
+        char moves[4];
+        int n = boardSuccessors(start, width, successors, moves);
+        for (int i = 0; i < n; i++) {
+            if (successors[i] == goal) {
+                return string(1, moves[i]);
+            }
+        }
+        return "";
+    }
 
-	emscripten_log(EM_LOG_CONSOLE, "No solution found. Expansions: %d, Max Queue: %d, Time: %.3f s",
-                       numOfStateExpansions, maxQLength, actualRunningTime);
+    PackedHeuristic h(goal, width, heuristic);
+    packedBoard relay = start;
+    int nextBound;
+    int relayDepth = distance / 2;
+    if (frontierLayers(start, goal, width, h, distance, relayDepth, relay, nextBound, stats) < 0) {
+        return ""; // Expansion budget exhausted
+    }
 
-	return "";
+    return frontierPath(start, relay, width, heuristic, relayDepth, stats) +
+           frontierPath(relay, goal, width, heuristic, distance - relayDepth, stats);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////////////
+//
+// Search Algorithm:  Divide-and-Conquer Breadth-First Heuristic Search (frontier search)
+//
+// Memory-lean alternative to aStar_ExpandedList: no closed list is kept. Each pass is a
+// breadth-first search pruned at f = g + h > bound that holds only three layers; the bound
+// starts at h(start) and rises to the smallest pruned f until the goal is reached. The path
+// is then recovered by divide and conquer: every state deeper than the relay layer carries its
+// ancestor from that layer, and the two halves are solved again with their exact lengths as
+// bounds. Time grows by roughly a log(pathLength) factor in exchange for layer-sized memory.
+//
+// Params:
+//   - initialState: Starting puzzle state (string, e.g., "123804765")
+//   - goalState: Target state (string, e.g., "123456780")
+//   - pathLength: Output for length of solution path
+//   - numOfStateExpansions: Output for number of states explored, over all passes
+//   - maxQLength: Output for the most states held in memory at once (peak of three layers)
+//   - actualRunningTime: Output for execution time in seconds
+//   - numOfDeletionsFromMiddleOfHeap: Unused (no heap)
+//   - numOfLocalLoopsAvoided: Unused (for loop avoidance stats)
+//   - numOfAttemptedNodeReExpansions: Output for successors dropped by layer duplicate detection
+//   - heuristic: Heuristic function (misplacedTiles or manhattanDistance)
+//   - maxExpansions: Give up (returning empty) if search and path recovery together need more expansions; 0 means no limit
+//
+// Returns: String of moves (e.g., "UDLR") or empty if unsolvable
+//
+////////////////////////////////////////////////////////////////////////////////////////////
+string frontier_bfhs(string const initialState, string const goalState, int& pathLength, int &numOfStateExpansions, int& maxQLength,
+                     float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions, heuristicFunction heuristic,
+                     int maxExpansions){
+
+    solverTime startTime = solverClock();
+
+    numOfDeletionsFromMiddleOfHeap = 0;
+    numOfLocalLoopsAvoided = 0;
+    numOfAttemptedNodeReExpansions = 0;
+    actualRunningTime = 0.0;
+
+    int width = 1;
+    while (width * width < (int)initialState.length()) {
+        width++;
+    }
+    packedBoard start = packBoard(initialState);
+    packedBoard goal = packBoard(goalState);
+    FrontierStats stats = {0, 1, 0, maxExpansions};
+    string path;
+    bool solved = false;
+
+    emscripten_log(EM_LOG_CONSOLE, "Frontier solver started with initial state: %s, heuristic: %d", initialState.c_str(), heuristic);
+
+    if (validQuery(initialState, goalState) && boardParity(start, width) == boardParity(goal, width)) {
+        PackedHeuristic h(goal, width, heuristic);
+        for (int bound = h(start); bound != INT_MAX; ) {
+            packedBoard relay = start;
+            int nextBound;
+            int relayDepth = max(bound / 2, 1);
+            int depth = frontierLayers(start, goal, width, h, bound, relayDepth, relay, nextBound, stats);
+
+            if (depth >= 0) {
+                // The relay is only on the path if the goal lies beyond the relay layer
+                if (depth > relayDepth) {
+                    path = frontierPath(start, relay, width, heuristic, relayDepth, stats) +
+                           frontierPath(relay, goal, width, heuristic, depth - relayDepth, stats);
+                } else {
+                    path = frontierPath(start, goal, width, heuristic, depth, stats);
+                }
+                // Recovery shares the budget; a half cut short by it comes back empty
+                solved = (int)path.length() == depth;
+                break;
+            }
+            bound = nextBound;
+        }
+    }
+
+    numOfStateExpansions += stats.expansions;
+    maxQLength = stats.maxStored;
+    numOfAttemptedNodeReExpansions = stats.duplicates;
+    actualRunningTime = secondsSince(startTime);
+
+    if (!solved) {
+        emscripten_log(EM_LOG_CONSOLE, "No solution found. Expansions: %d, Max Stored: %d, Time: %.3f s",
+                       numOfStateExpansions, maxQLength, actualRunningTime);
+        return "";
+    }
 
+    pathLength = path.length();
+    emscripten_log(EM_LOG_CONSOLE, "Solution found! Path: %s, Length: %d, Expansions: %d, Max Stored: %d, Time: %.3f s",
+                   path.c_str(), pathLength, numOfStateExpansions, maxQLength, actualRunningTime);
+    return path;
 }
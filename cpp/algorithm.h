@@ -20,14 +20,29 @@
 // Params: See algorithm.cpp for details
 // Returns: String of moves or empty if unsolvable
 string uc_explist(string const initialState, string const goalState, int& pathLength, int &numOfStateExpansions, int& maxQLength,
-                          float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions);
+                          float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions,
+                          int maxExpansions = 0);
 
 // Purpose: Declares A* solver for the 8-puzzle with a specified heuristic.
 // Params: See algorithm.cpp for details
 // Returns: String of moves or empty if unsolvable
 string aStar_ExpandedList(string const initialState, string const goalState, int& pathLength, int &numOfStateExpansions, int& maxQLength,
-                          float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions, heuristicFunction heuristic);
+                          float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions, heuristicFunction heuristic,
+                          int maxExpansions = 0);
 
 
+// Purpose: Declares memory-lean frontier solver (divide-and-conquer breadth-first heuristic search).
+// Params: See algorithm.cpp for details
+// Returns: String of moves or empty if unsolvable
+string frontier_bfhs(string const initialState, string const goalState, int& pathLength, int &numOfStateExpansions, int& maxQLength,
+                     float &actualRunningTime, int &numOfDeletionsFromMiddleOfHeap, int &numOfLocalLoopsAvoided, int &numOfAttemptedNodeReExpansions, heuristicFunction heuristic,
+                     int maxExpansions = 0);
+
+// Purpose: Declares single-search Uniform Cost solver that answers several goals at once.
+// Params: See algorithm.cpp for details
+// Returns: One string of moves per goal, empty for unreachable goals (pathLengths entry is -1)
+vector<string> uc_multiGoal(string const initialState, vector<string> const &goalStates, vector<int> &pathLengths,
+                            int &numOfStateExpansions, int& maxQLength, float &actualRunningTime);
+
 
 #endif
\ No newline at end of file
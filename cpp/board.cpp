@@ -0,0 +1,339 @@
+// File: board.cpp
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Implements the compact 64-bit board encoding.
+
+#include <vector>
+
+#include "board.h"
+
+using namespace std;
+
+packedBoard packBoard(string const state){
+    packedBoard board = 0;
+    for (int i = 0; i < (int)state.length() && i < MAX_BOARD_CELLS; i++) {
+        board |= (packedBoard)((state[i] - '0') & 0xF) << (4 * i);
+    }
+    return board;
+}
+
+string unpackBoard(packedBoard board, int cells){
+    string state(cells, '0');
+    for (int i = 0; i < cells; i++) {
+        state[i] = (char)('0' + tileAt(board, i));
+    }
+    return state;
+}
+
+int blankCell(packedBoard board, int cells){
+    for (int i = 0; i < cells; i++) {
+        if (tileAt(board, i) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Moves the tile in cell `from` into the blank at cell `blank`.
+static packedBoard slideInto(packedBoard board, int blank, int from){
+    packedBoard tile = (board >> (4 * from)) & 0xF;
+    board &= ~((packedBoard)0xF << (4 * from));
+    return board | (tile << (4 * blank));
+}
+
+int boardSuccessors(packedBoard board, int width, packedBoard next[4], char moves[4]){
+    int blank = blankCell(board, width * width);
+    int x = blank % width, y = blank / width;
+    int n = 0;
+
+    if (y > 0) {
+        next[n] = slideInto(board, blank, blank - width);
+        moves[n++] = 'U';
+    }
+    if (x < width - 1) {
+        next[n] = slideInto(board, blank, blank + 1);
+        moves[n++] = 'R';
+    }
+    if (y < width - 1) {
+        next[n] = slideInto(board, blank, blank + width);
+        moves[n++] = 'D';
+    }
+    if (x > 0) {
+        next[n] = slideInto(board, blank, blank - 1);
+        moves[n++] = 'L';
+    }
+    return n;
+}
+
+int boardParity(packedBoard board, int width){
+    int cells = width * width;
+    int inversions = 0, blank = 0;
+    for (int i = 0; i < cells; i++) {
+        int t = tileAt(board, i);
+        if (t == 0) {
+            blank = i;
+            continue;
+        }
+        for (int j = i + 1; j < cells; j++) {
+            int u = tileAt(board, j);
+            if (u != 0 && u < t) {
+                inversions++;
+            }
+        }
+    }
+    // A vertical move shifts one tile past width - 1 others: an even count on odd widths,
+    // an odd count on even widths, where it is balanced by the change of blank row.
+    int row = (width % 2 == 0) ? blank / width : 0;
+    return (inversions + row) & 1;
+}
+
+char inverseMove(char m){
+    switch (m) {
+        case 'U': return 'D';
+        case 'D': return 'U';
+        case 'L': return 'R';
+        default: return 'L';
+    }
+}
+
+packedBoard applyMoves(packedBoard board, int width, string const moves){
+    packedBoard start = board;
+    int blank = blankCell(board, width * width);
+
+    for (char m : moves) {
+        int x = blank % width, y = blank / width;
+        int target;
+        switch (m) {
+            case 'U': if (y == 0) return start; target = blank - width; break;
+            case 'R': if (x == width - 1) return start; target = blank + 1; break;
+            case 'D': if (y == width - 1) return start; target = blank + width; break;
+            case 'L': if (x == 0) return start; target = blank - 1; break;
+            default: return start;
+        }
+        board = slideInto(board, blank, target);
+        blank = target;
+    }
+    return board;
+}
+
+bool validBoard(string const state){
+    int cells = (int)state.length();
+    if (cells != 9 && cells != 16) {
+        return false;
+    }
+    vector<bool> seen(cells, false);
+    for (char c : state) {
+        int t = c - '0';
+        if (t < 0 || t >= cells || seen[t]) {
+            return false;
+        }
+        seen[t] = true;
+    }
+    return true;
+}
+
+bool validPattern(string const state){
+    int cells = (int)state.length();
+    if (cells != 9 && cells != 16) {
+        return false;
+    }
+    int blanks = 0;
+    for (char c : state) {
+        int t = c - '0';
+        if (t < 0 || t >= cells) {
+            return false;
+        }
+        blanks += t == 0;
+    }
+    return blanks == 1;
+}
+
+//////////////////////////////////////////////////////////////
+//Constructor: StateIndexer
+//Purpose: Precomputes factorials and the tile-order parity each blank cell must have to be reachable from goal.
+// Params:
+//   - goal: Goal state string; its length fixes the board size
+//////////////////////////////////////////////////////////////
+StateIndexer::StateIndexer(string const goal){
+    cells = (int)goal.length();
+    width = 1;
+    while (width * width < cells) {
+        width++;
+    }
+
+    factorials[0] = 1;
+    for (int i = 1; i <= MAX_BOARD_CELLS; i++) {
+        factorials[i] = factorials[i - 1] * i;
+    }
+
+    // On odd widths the tile-order parity is the same for every blank cell; on even widths
+    // it flips with every change of blank row (see boardParity).
+    packedBoard goalBoard = packBoard(goal);
+    int goalParity = boardParity(goalBoard, width);
+    for (int b = 0; b < cells; b++) {
+        int row = (width % 2 == 0) ? b / width : 0;
+        requiredParity[b] = (goalParity + row) & 1;
+    }
+}
+
+long long StateIndexer::size(){
+    return factorials[cells] / 2;
+}
+
+long long StateIndexer::rank(packedBoard board){
+    int m = cells - 1;
+    int tiles[MAX_BOARD_CELLS];
+    int blank = 0, n = 0;
+
+    for (int i = 0; i < cells; i++) {
+        int t = tileAt(board, i);
+        if (t == 0) {
+            blank = i;
+        } else {
+            tiles[n++] = t;
+        }
+    }
+
+    long long lehmer = 0;
+    for (int i = 0; i < m; i++) {
+        int smaller = 0;
+        for (int j = i + 1; j < m; j++) {
+            if (tiles[j] < tiles[i]) {
+                smaller++;
+            }
+        }
+        lehmer += smaller * factorials[m - 1 - i];
+    }
+
+    return blank * (factorials[m] / 2) + lehmer / 2;
+}
+
+packedBoard StateIndexer::unrank(long long index){
+    int m = cells - 1;
+    long long half = factorials[m] / 2;
+    int blank = (int)(index / half);
+    long long lehmer = (index % half) * 2;
+
+    // Decode Lehmer digits; the 1! digit was dropped by rank() and is restored from the parity
+    int digits[MAX_BOARD_CELLS];
+    int paritySum = 0;
+    for (int i = 0; i < m; i++) {
+        digits[i] = (int)(lehmer / factorials[m - 1 - i]);
+        lehmer %= factorials[m - 1 - i];
+        paritySum += digits[i];
+    }
+    if (m >= 2 && (paritySum & 1) != requiredParity[blank]) {
+        digits[m - 2] = 1;
+    }
+
+    bool used[MAX_BOARD_CELLS] = {false};
+    packedBoard board = 0;
+    int cell = 0;
+    for (int i = 0; i < m; i++, cell++) {
+        if (cell == blank) {
+            cell++;
+        }
+        // Pick the (digits[i]+1)-th smallest unused tile
+        int t = 1;
+        for (int k = digits[i]; ; t++) {
+            if (!used[t]) {
+                if (k == 0) {
+                    break;
+                }
+                k--;
+            }
+        }
+        used[t] = true;
+        board |= (packedBoard)t << (4 * cell);
+    }
+    return board;
+}
+
+//////////////////////////////////////////////////////////////
+//Constructor: PatternIndexer
+//Purpose: Splits the goal's tiles into tracked (written once) and don't-care (the repeated character).
+// Params:
+//   - goal: Goal state string, e.g. "1234<<<<<<<<<<<0" tracks the blank and tiles 1-4 of a 4x4 board
+//////////////////////////////////////////////////////////////
+PatternIndexer::PatternIndexer(string const goal){
+    cells = (int)goal.length();
+    width = 1;
+    while (width * width < cells) {
+        width++;
+    }
+
+    int occurrences[MAX_BOARD_CELLS] = {0};
+    for (char c : goal) {
+        occurrences[(c - '0') & 0xF]++;
+    }
+
+    dontCare = 0;
+    tracked = 0;
+    for (int t = 0; t < MAX_BOARD_CELLS; t++) {
+        trackIndex[t] = -1;
+        if (occurrences[t] == 1) {
+            trackIndex[t] = tracked;
+            trackedTile[tracked++] = t;
+        } else if (occurrences[t] > 1) {
+            dontCare = t;
+        }
+    }
+
+    indexCount = 1;
+    for (int i = 0; i < tracked; i++) {
+        indexCount *= cells - i;
+    }
+}
+
+long long PatternIndexer::rank(packedBoard board){
+    int cellOf[MAX_BOARD_CELLS];
+    for (int i = 0; i < cells; i++) {
+        int k = trackIndex[tileAt(board, i)];
+        if (k >= 0) {
+            cellOf[k] = i;
+        }
+    }
+
+    long long index = 0;
+    unsigned used = 0;
+    for (int i = 0; i < tracked; i++) {
+        // Position of the cell among the cells not yet taken by earlier tracked tiles
+        int free = cellOf[i] - __builtin_popcount(used & ((1u << cellOf[i]) - 1));
+        index = index * (cells - i) + free;
+        used |= 1u << cellOf[i];
+    }
+    return index;
+}
+
+packedBoard PatternIndexer::unrank(long long index){
+    int digits[MAX_BOARD_CELLS];
+    for (int i = tracked - 1; i >= 0; i--) {
+        digits[i] = (int)(index % (cells - i));
+        index /= cells - i;
+    }
+
+    int tileIn[MAX_BOARD_CELLS];
+    for (int c = 0; c < cells; c++) {
+        tileIn[c] = dontCare;
+    }
+    unsigned used = 0;
+    for (int i = 0; i < tracked; i++) {
+        int c = 0;
+        for (int free = digits[i]; ; c++) {
+            if (!(used & (1u << c))) {
+                if (free == 0) {
+                    break;
+                }
+                free--;
+            }
+        }
+        used |= 1u << c;
+        tileIn[c] = trackedTile[i];
+    }
+
+    packedBoard board = 0;
+    for (int c = 0; c < cells; c++) {
+        board |= (packedBoard)tileIn[c] << (4 * c);
+    }
+    return board;
+}
@@ -0,0 +1,134 @@
+// File: board.h
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Compact 64-bit board encoding shared by the state table and native tools.
+
+#ifndef __BOARD_H__
+#define __BOARD_H__
+
+#include <string>
+
+#include "puzzle.h"
+
+using namespace std;
+
+// A board packed four bits per cell, cell 0 in the lowest nibble. Holds any board up to 4x4.
+typedef unsigned long long packedBoard;
+
+// Purpose: Packs a state string (e.g., "123804765") into a packedBoard.
+// Params:
+//   - state: One character per cell, tile value = character - '0'
+// Returns: Packed board
+packedBoard packBoard(string const state);
+
+// Purpose: Expands a packedBoard back into its state string.
+// Params:
+//   - board: Packed board
+//   - cells: Number of cells on the board (9 for 3x3, 16 for 4x4)
+// Returns: State string in the same format accepted by Puzzle
+string unpackBoard(packedBoard board, int cells);
+
+// Returns: Tile stored in the given cell of a packed board
+inline int tileAt(packedBoard board, int cell){
+    return (int)((board >> (4 * cell)) & 0xF);
+}
+
+// Returns: Cell index of the blank (tile 0)
+int blankCell(packedBoard board, int cells);
+
+// Purpose: Generates the successors of a board in the solvers' move order (U, R, D, L).
+// Params:
+//   - board: Packed board
+//   - width: Board width (3 or 4)
+//   - next: Receives up to four successor boards
+//   - moves: Receives the move letter for each successor ('U' moves the blank up, etc.)
+// Returns: Number of successors written
+int boardSuccessors(packedBoard board, int width, packedBoard next[4], char moves[4]);
+
+// Purpose: Solvability invariant of a board; two boards of the same size are reachable
+//          from each other exactly when their parities match.
+// Returns: 0 or 1
+int boardParity(packedBoard board, int width);
+
+// Returns: The move that undoes m ('U' <-> 'D', 'L' <-> 'R')
+char inverseMove(char m);
+
+// Purpose: Applies a move string to a board.
+// Returns: Resulting board, or the input board unchanged if a move would leave the grid
+packedBoard applyMoves(packedBoard board, int width, string const moves);
+
+// Returns: True if state is a 3x3 or 4x4 board holding each tile exactly once
+bool validBoard(string const state);
+
+// Returns: True if state is a 3x3 or 4x4 board with exactly one blank and every other character a tile
+//          value of that board; tiles may repeat (abstractions and pattern goals)
+bool validPattern(string const state);
+
+// Maps every board reachable from a goal to a dense index in [0, cells!/2) and back.
+// The index is blankCell * (m!/2) + floor(lehmerRank(tile order) / 2) with m = cells - 1;
+// the dropped low bit is recovered from the solvability parity fixed by the goal.
+class StateIndexer{
+
+private:
+
+    int width;
+    int cells;
+    long long factorials[MAX_BOARD_CELLS + 1];
+    int requiredParity[MAX_BOARD_CELLS]; // Parity of the tile-order inversions for each blank cell
+
+public:
+
+    StateIndexer(string const goal);
+
+    int getWidth(){
+        return width;
+    }
+    int getCells(){
+        return cells;
+    }
+
+    // Returns: Number of indices (cells!/2)
+    long long size();
+
+    long long rank(packedBoard board);
+    packedBoard unrank(long long index);
+
+};
+
+// Dense index for pattern-database abstractions: only the blank and the tiles written once in the goal are
+// tracked, and every tile sharing the repeated character is interchangeable ("don't care"). The index is the
+// mixed-radix encoding of the tracked tiles' cells, so size() = cells! / (cells - tracked)!. A goal with
+// no repeated character tracks every tile; StateIndexer is then half the size.
+class PatternIndexer{
+
+private:
+
+    int width;
+    int cells;
+    int tracked;                      // Number of tracked tiles, blank included
+    int trackedTile[MAX_BOARD_CELLS]; // Tile values in index order, blank first
+    int trackIndex[MAX_BOARD_CELLS];  // Tile value -> position in trackedTile, or -1
+    int dontCare;                     // Tile value written into untracked cells
+    long long indexCount;
+
+public:
+
+    PatternIndexer(string const goal);
+
+    int getWidth(){
+        return width;
+    }
+    int getCells(){
+        return cells;
+    }
+
+    long long size(){
+        return indexCount;
+    }
+
+    long long rank(packedBoard board);
+    packedBoard unrank(long long index);
+
+};
+
+#endif
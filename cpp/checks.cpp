@@ -0,0 +1,302 @@
+// File: checks.cpp
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Native self-checks for the board encoding and the native tools' building blocks.
+//
+// Build: g++ -O2 -std=c++17 -pthread checks.cpp board.cpp statetable.cpp algorithm.cpp puzzle.cpp symmetry.cpp -o checks && ./checks
+//
+// Every check prints one line; the exit status is the number of failed checks.
+
+#include <cstdio>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "algorithm.h"
+#include "board.h"
+#include "parallelbfs.h"
+#include "symmetry.h"
+
+using namespace std;
+
+
+static int failures = 0;
+
+static void report(bool ok, string const name){
+    printf("%s  %s\n", ok ? "ok  " : "FAIL", name.c_str());
+    failures += ok ? 0 : 1;
+}
+
+
+// StateIndexer must be a bijection between [0, size) and the boards reachable from the goal.
+static void checkStateIndexer(){
+    StateIndexer indexer("123456780");
+    bool ok = indexer.size() == 181440;
+    int goalParity = boardParity(packBoard("123456780"), 3);
+    for (long long r = 0; ok && r < indexer.size(); r++) {
+        packedBoard board = indexer.unrank(r);
+        ok = indexer.rank(board) == r && boardParity(board, 3) == goalParity && validBoard(unpackBoard(board, 9));
+    }
+    report(ok, "StateIndexer rank/unrank bijection over all 181440 3x3 states");
+}
+
+static void checkPatternIndexer(){
+    PatternIndexer indexer("1234<<<<<<<<<<<0");
+    bool ok = indexer.size() == 16LL * 15 * 14 * 13 * 12;
+    for (long long r = 0; ok && r < indexer.size(); r++) {
+        ok = indexer.rank(indexer.unrank(r)) == r;
+    }
+    ok = ok && indexer.unrank(indexer.rank(packBoard("1234<<<<<<<<<<<0"))) == packBoard("1234<<<<<<<<<<<0");
+    report(ok, "PatternIndexer rank/unrank bijection for 1234<<<<<<<<<<<0");
+}
+
+static void checkValidation(){
+    report(validBoard("123456780") && validBoard("123456789:;<=>?0"), "validBoard accepts permutations");
+    report(!validBoard("123456788") && !validBoard("12345678") && !validBoard("1234567a0"),
+           "validBoard rejects repeated, missing and out-of-range tiles");
+    report(validPattern("1234<<<<<<<<<<<0") && !validPattern("123456788") && !validPattern("120456780"),
+           "validPattern needs exactly one blank");
+}
+
+
+// Purpose: Runs one of the single-goal solvers by name.
+// Returns: The move string; pathLength and numOfStateExpansions are filled in
+static string solve(string const algorithm, string const start, string const goal, int &pathLength,
+                    int &numOfStateExpansions, int maxExpansions = 0){
+    int maxQLength = 0, numOfDeletions = 0, numOfLocalLoops = 0, numOfReExpansions = 0;
+    float actualRunningTime = 0.0;
+    pathLength = 0;
+    numOfStateExpansions = 0;
+
+    if (algorithm == "uc") {
+        return uc_explist(start, goal, pathLength, numOfStateExpansions, maxQLength, actualRunningTime,
+                          numOfDeletions, numOfLocalLoops, numOfReExpansions, maxExpansions);
+    }
+    if (algorithm == "astar") {
+        return aStar_ExpandedList(start, goal, pathLength, numOfStateExpansions, maxQLength, actualRunningTime,
+                                  numOfDeletions, numOfLocalLoops, numOfReExpansions, manhattanDistance, maxExpansions);
+    }
+    return frontier_bfhs(start, goal, pathLength, numOfStateExpansions, maxQLength, actualRunningTime,
+                         numOfDeletions, numOfLocalLoops, numOfReExpansions, manhattanDistance, maxExpansions);
+}
+
+// Every solver must return an optimal path, i.e. one as long as the exhaustive distance table says.
+static void checkSolvers(){
+    string goal = "123456780";
+    StateIndexer indexer(goal);
+    vector<unsigned char> distance;
+    parallelDistanceTable(indexer, packBoard(goal), 1, distance);
+
+    string algorithms[] = {"uc", "astar", "frontier"};
+    int strides[] = {20011, 4001, 4001};
+    for (int a = 0; a < 3; a++) {
+        bool ok = true;
+        for (long long r = 0; ok && r < indexer.size(); r += strides[a]) {
+            packedBoard board = indexer.unrank(r);
+            int pathLength, expansions;
+            string path = solve(algorithms[a], unpackBoard(board, 9), goal, pathLength, expansions);
+            ok = pathLength == distance[r] && (int)path.length() == pathLength &&
+                 applyMoves(board, 3, path) == packBoard(goal);
+        }
+        report(ok, algorithms[a] + " path lengths match the distance table");
+    }
+
+    bool rejected = true;
+    for (int a = 0; a < 3; a++) {
+        int pathLength, expansions;
+        rejected = rejected && solve(algorithms[a], "123456780", "12345678z", pathLength, expansions).empty() &&
+                   solve(algorithms[a], "123456780123", "123456780", pathLength, expansions).empty() && expansions == 0;
+    }
+    report(rejected, "solvers return no path for malformed boards without searching");
+}
+
+
+// uc_multiGoal answers every goal from one search: duplicates, the start itself and goals of the wrong
+// parity included.
+static void checkMultiGoal(){
+    string start = "123456780";
+    StateIndexer indexer(start);
+    vector<unsigned char> distance;
+    parallelDistanceTable(indexer, packBoard(start), 1, distance);
+
+    vector<string> goals;
+    vector<long long> ranks;
+    for (long long r = 7; r < indexer.size(); r += 9973) {
+        goals.push_back(unpackBoard(indexer.unrank(r), 9));
+        ranks.push_back(r);
+    }
+    goals.push_back(goals[0]);
+    ranks.push_back(ranks[0]);
+    goals.push_back(start);
+    ranks.push_back(indexer.rank(packBoard(start)));
+
+    vector<int> lengths;
+    int expansions = 0, maxQLength = 0;
+    float actualRunningTime = 0.0;
+    vector<string> paths = uc_multiGoal(start, goals, lengths, expansions, maxQLength, actualRunningTime);
+    bool ok = paths.size() == goals.size() && lengths.size() == goals.size();
+    for (size_t i = 0; ok && i < goals.size(); i++) {
+        ok = lengths[i] == distance[ranks[i]] && (int)paths[i].length() == lengths[i] &&
+             applyMoves(packBoard(start), 3, paths[i]) == packBoard(goals[i]);
+    }
+    report(ok && lengths.back() == 0 && paths[0] == paths[goals.size() - 2],
+           "uc_multiGoal paths reach every goal (duplicates and the start included) at table distance");
+
+    // Swapping two tiles flips the parity: unreachable, and must not trigger a sweep of the whole space
+    string unreachable = "213456780";
+    expansions = 0;
+    paths = uc_multiGoal(start, vector<string>(1, unreachable), lengths, expansions, maxQLength, actualRunningTime);
+    ok = lengths.size() == 1 && lengths[0] == -1 && paths[0].empty() && expansions == 0;
+
+    vector<string> mixed;
+    mixed.push_back(unreachable);
+    mixed.push_back("123456708");
+    expansions = 0;
+    paths = uc_multiGoal(start, mixed, lengths, expansions, maxQLength, actualRunningTime);
+    ok = ok && lengths[0] == -1 && lengths[1] == 1 && expansions < 10;
+    report(ok, "uc_multiGoal returns -1 for the other parity without searching the whole space");
+}
+
+// Purpose: Builds the table for one goal with 1 and with several threads.
+// Returns: True if both runs produce identical distances and per-depth counts
+template <class Indexer>
+static bool sameTableOnThreads(string const goal, int threads){
+    Indexer indexer(goal);
+    vector<unsigned char> serial, parallel;
+    vector<long long> serialCounts = parallelDistanceTable(indexer, packBoard(goal), 1, serial);
+    vector<long long> parallelCounts = parallelDistanceTable(indexer, packBoard(goal), threads, parallel);
+    return serial == parallel && serialCounts == parallelCounts;
+}
+
+static void checkParallelTables(){
+    report(sameTableOnThreads<StateIndexer>("123456780", 4), "3x3 distance table is identical on 1 and 4 threads");
+    report(sameTableOnThreads<PatternIndexer>("1234<<<<<<<<<<<0", 4), "1234<<<<<<<<<<<0 pattern table is identical on 1 and 4 threads");
+}
+
+// A solve that needs exactly E expansions must succeed with budget E and fail with budget E - 1, and the
+// reported count must never exceed the budget.
+static void checkBudgets(){
+    string algorithms[] = {"uc", "astar", "frontier"};
+    for (int a = 0; a < 3; a++) {
+        int pathLength, needed, used;
+        solve(algorithms[a], "867254301", "123456780", pathLength, needed);
+        bool ok = pathLength == 31 && !solve(algorithms[a], "867254301", "123456780", pathLength, used, needed).empty() &&
+                  used == needed;
+        ok = ok && solve(algorithms[a], "867254301", "123456780", pathLength, used, needed - 1).empty() && used <= needed - 1;
+        report(ok, algorithms[a] + " honours the expansion budget exactly");
+    }
+}
+
+// A canonical query must have the same optimal length as the original, so length caches can key on it.
+static void checkCanonicalQuery(){
+    StateIndexer indexer("123456780");
+    mt19937_64 rng(7);
+    uniform_int_distribution<long long> pick(0, indexer.size() - 1);
+    set<CanonicalQuery> distinct;
+    bool ok = true;
+    for (int i = 0; ok && i < 200; i++) {
+        packedBoard start = indexer.unrank(pick(rng));
+        packedBoard goal = indexer.unrank(pick(rng));
+        CanonicalQuery q = canonicalQuery(start, goal, 3);
+        distinct.insert(q);
+
+        int directLength, canonicalLength, expansions;
+        solve("astar", unpackBoard(start, 9), unpackBoard(goal, 9), directLength, expansions);
+        solve("astar", unpackBoard(q.start, 9), unpackBoard(q.goal, 9), canonicalLength, expansions);
+        CanonicalQuery mirrored = canonicalQuery(goal, start, 3);
+        ok = canonicalLength == directLength && !(mirrored < q) && !(q < mirrored);
+    }
+    report(ok && distinct.size() > 1, "canonical queries keep the optimal length and are shared by the reversed query");
+}
+
+// A SymmetricIndexer table must agree with the full table for every state.
+static void checkSymmetricTable(){
+    string goal = "123456780";
+    StateIndexer states(goal);
+    SymmetricIndexer classes(goal);
+    vector<unsigned char> full, folded;
+    parallelDistanceTable(states, packBoard(goal), 1, full);
+    vector<long long> counts = parallelDistanceTable(classes, packBoard(goal), 4, folded);
+
+    bool ok = classes.available() && classes.size() == 90792 && counts.size() == 32;
+    for (long long r = 0; ok && r < states.size(); r++) {
+        packedBoard members[2];
+        packedBoard board = states.unrank(r);
+        long long c = classes.rank(board);
+        int n = classes.members(board, members);
+        ok = folded[c] == full[r] && classes.rank(members[n - 1]) == c && (members[0] == board || members[1] == board);
+    }
+    for (long long c = 0; ok && c < classes.size(); c++) {
+        ok = classes.rank(classes.unrank(c)) == c;
+    }
+    report(ok, "SymmetricIndexer table for 123456780 has 90792 entries that match the full table");
+}
+
+// Purpose: Breadth-first search over BoardSymmetry classes, as externalbfs --symmetric enumerates them.
+// Returns: Number of classes at each depth
+static vector<long long> symmetricLayers(BoardSymmetry &symmetry, packedBoard start, int width){
+    vector<long long> counts;
+    set<packedBoard> previous, current, next;
+    current.insert(symmetry.canonical(start));
+    while (!current.empty()) {
+        counts.push_back(current.size());
+        next.clear();
+        for (packedBoard board : current) {
+            packedBoard successors[4];
+            char moves[4];
+            int n = boardSuccessors(board, width, successors, moves);
+            for (int i = 0; i < n; i++) {
+                packedBoard c = symmetry.canonical(successors[i]);
+                if (!previous.count(c) && !current.count(c)) {
+                    next.insert(c);
+                }
+            }
+        }
+        previous.swap(current);
+        current.swap(next);
+    }
+    return counts;
+}
+
+// The symmetric histogram must fold the plain one: each depth holds exactly the classes of that depth's states.
+static void checkSymmetricFold(){
+    string goal = "123456780";
+    StateIndexer indexer(goal);
+    vector<unsigned char> distance;
+    vector<long long> plain = parallelDistanceTable(indexer, packBoard(goal), 1, distance);
+
+    BoardSymmetry symmetry(packBoard(goal), 3);
+    vector<long long> folded = symmetricLayers(symmetry, packBoard(goal), 3);
+
+    vector<set<packedBoard> > classes(plain.size());
+    for (long long r = 0; r < indexer.size(); r++) {
+        classes[distance[r]].insert(symmetry.canonical(indexer.unrank(r)));
+    }
+    bool ok = symmetry.available() && folded.size() == plain.size() && plain.size() == 32;
+    long long total = 0;
+    for (size_t d = 0; ok && d < folded.size(); d++) {
+        ok = folded[d] == (long long)classes[d].size();
+        total += folded[d];
+    }
+    report(ok && total == 90792, "symmetric 123456780 histogram folds the plain one (max depth 31, 90792 classes)");
+
+    report(!BoardSymmetry(packBoard("1234<<<<<<<<<<<0"), 4).available() &&
+           !BoardSymmetry(packBoard("123450678"), 3).available(),
+           "BoardSymmetry is unavailable for don't-care patterns and an off-diagonal blank");
+}
+
+
+int main(){
+    checkStateIndexer();
+    checkPatternIndexer();
+    checkValidation();
+    checkParallelTables();
+    checkSolvers();
+    checkMultiGoal();
+    checkBudgets();
+    checkCanonicalQuery();
+    checkSymmetricTable();
+    checkSymmetricFold();
+    return failures;
+}
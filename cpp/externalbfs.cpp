@@ -0,0 +1,403 @@
+// File: externalbfs.cpp
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Native breadth-first enumeration of a puzzle state space that keeps its layers on disk,
+//              for state spaces (or 4x4 subspaces) larger than RAM.
+//
+// Build: g++ -O2 -std=c++17 externalbfs.cpp board.cpp symmetry.cpp -o externalbfs
+//
+// Usage: externalbfs --start STATE [--dir DIR] [--memory STATES] [--max-depth D] [--symmetric]
+//
+//   STATE may repeat tile characters: tiles sharing a character are interchangeable, which enumerates
+//   an abstraction of the full puzzle (e.g. "123456789:;<<<<0" keeps tiles 1-11 and merges the rest).
+//   --symmetric stores one representative per transpose-symmetry class (see BoardSymmetry), roughly
+//   halving the layer files; counts are then per class. It needs a start with distinct tiles and its blank
+//   on the main diagonal.
+//
+// Each layer is expanded in one sequential pass. Successors are buffered in RAM (at most --memory states),
+// sorted and written out as run files; the runs are then merged and, in the same pass, compared against the
+// two previous layers (delayed duplicate detection). Only sequential reads and writes are used.
+//
+// Output in DIR:
+//   layer_NNN.bin   Sorted states at depth NNN, delta + varint compressed (see LayerWriter)
+//   histogram.txt   "# start STATE[/symmetric]" then one "depth count" line per completed layer
+//
+// The histogram is rewritten atomically after every layer and doubles as the checkpoint: rerunning with
+// the same --dir resumes after the last completed layer, discarding any partial runs. A failed write (e.g. a
+// full disk) stops the run before the checkpoint advances past the incomplete layer.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "board.h"
+#include "symmetry.h"
+
+using namespace std;
+
+
+// Merging more runs than this at once would need too many open files; larger sets are merged in passes.
+const int MAX_MERGE_FANIN = 64;
+
+
+// Writes a strictly increasing sequence of packed boards as LEB128 varints of the gap to the previous one.
+class LayerWriter{
+
+private:
+
+    ofstream out;
+    packedBoard last;
+    long long count;
+
+public:
+
+    LayerWriter(string const fileName) : out(fileName.c_str(), ios::binary), last(0), count(0) {}
+
+    bool good(){
+        return (bool)out;
+    }
+
+    void put(packedBoard board){
+        packedBoard gap = board - last;
+        last = board;
+        count++;
+        while (gap >= 0x80) {
+            out.put((char)((gap & 0x7F) | 0x80));
+            gap >>= 7;
+        }
+        out.put((char)gap);
+    }
+
+    long long getCount(){
+        return count;
+    }
+
+    // Returns: False if any write failed (e.g. the disk is full)
+    bool close(){
+        out.close();
+        return !out.fail();
+    }
+
+};
+
+// Reads a file produced by LayerWriter; a missing file reads as empty.
+class LayerReader{
+
+private:
+
+    ifstream in;
+    packedBoard last;
+
+public:
+
+    packedBoard current;
+    bool valid;
+
+    LayerReader(string const fileName) : in(fileName.c_str(), ios::binary), last(0), current(0), valid(false) {
+        next();
+    }
+
+    // Advances to the next board; valid is false once the file is exhausted.
+    void next(){
+        packedBoard gap = 0;
+        int shift = 0;
+        int c;
+        while ((c = in.get()) != EOF) {
+            gap |= (packedBoard)(c & 0x7F) << shift;
+            shift += 7;
+            if (!(c & 0x80)) {
+                last += gap;
+                current = last;
+                valid = true;
+                return;
+            }
+        }
+        valid = false;
+    }
+
+    // Advances past every board smaller than target.
+    // Returns: True if target itself is present
+    bool skipTo(packedBoard target){
+        while (valid && current < target) {
+            next();
+        }
+        return valid && current == target;
+    }
+
+};
+
+
+static string layerName(string const dir, int depth){
+    char name[32];
+    snprintf(name, sizeof(name), "/layer_%03d.bin", depth);
+    return dir + name;
+}
+
+static string runName(string const dir, int pass, int run){
+    char name[40];
+    snprintf(name, sizeof(name), "/run_%d_%d.tmp", pass, run);
+    return dir + name;
+}
+
+
+// Purpose: Sorts and de-duplicates the in-memory buffer and writes it as a new run file.
+// Returns: False if the run could not be written completely
+static bool flushRun(vector<packedBoard> &buffer, string const fileName){
+    sort(buffer.begin(), buffer.end());
+    buffer.erase(unique(buffer.begin(), buffer.end()), buffer.end());
+
+    LayerWriter run(fileName);
+    for (packedBoard board : buffer) {
+        run.put(board);
+    }
+    buffer.clear();
+    return run.close();
+}
+
+
+// Purpose: k-way merge of sorted runs into one sorted, duplicate-free file. Boards present in any of the
+//          exclude files (also sorted) are dropped; they are scanned once, in step with the merge.
+// Returns: Number of boards written, or -1 if the output could not be written completely
+static long long mergeRuns(vector<string> const &inputs, string const output, vector<string> const &excludes){
+    vector<LayerReader *> readers;
+    for (string const &name : inputs) {
+        readers.push_back(new LayerReader(name));
+    }
+    vector<LayerReader *> excluded;
+    for (string const &name : excludes) {
+        excluded.push_back(new LayerReader(name));
+    }
+
+    LayerWriter out(output);
+    bool first = true;
+    packedBoard previous = 0;
+
+    while (true) {
+        // Fan-in is small, so a linear scan for the minimum beats maintaining a heap
+        LayerReader *smallest = NULL;
+        for (LayerReader *r : readers) {
+            if (r->valid && (smallest == NULL || r->current < smallest->current)) {
+                smallest = r;
+            }
+        }
+        if (smallest == NULL) {
+            break;
+        }
+
+        packedBoard board = smallest->current;
+        smallest->next();
+        if (!first && board == previous) {
+            continue;
+        }
+        first = false;
+        previous = board;
+
+        bool seen = false;
+        for (LayerReader *e : excluded) {
+            seen = e->skipTo(board) || seen;
+        }
+        if (!seen) {
+            out.put(board);
+        }
+    }
+    bool written = out.close();
+
+    for (LayerReader *r : readers) {
+        delete r;
+    }
+    for (LayerReader *e : excluded) {
+        delete e;
+    }
+    return written ? out.getCount() : -1;
+}
+
+
+// Purpose: Deletes run files left behind by an interrupted layer.
+static void removeStaleRuns(string const dir){
+    DIR *d = opendir(dir.c_str());
+    if (d == NULL) {
+        return;
+    }
+    for (struct dirent *e = readdir(d); e != NULL; e = readdir(d)) {
+        string name = e->d_name;
+        if (name.compare(0, 4, "run_") == 0 || name.find(".bin.tmp") != string::npos) {
+            remove((dir + "/" + name).c_str());
+        }
+    }
+    closedir(d);
+}
+
+
+// Purpose: Rewrites the histogram/checkpoint file via a temporary file so an interruption never leaves it torn.
+static bool writeHistogram(string const dir, string const start, vector<long long> const &counts){
+    string tmp = dir + "/histogram.txt.tmp";
+    FILE *f = fopen(tmp.c_str(), "w");
+    if (f == NULL) {
+        return false;
+    }
+    fprintf(f, "# start %s\n", start.c_str());
+    for (size_t d = 0; d < counts.size(); d++) {
+        fprintf(f, "%d %lld\n", (int)d, counts[d]);
+    }
+    bool written = !ferror(f);
+    written = fclose(f) == 0 && written;
+    return written && rename(tmp.c_str(), (dir + "/histogram.txt").c_str()) == 0;
+}
+
+// Purpose: Loads the layer counts of a previous run with the same start state.
+// Returns: False if there is no usable checkpoint
+static bool readHistogram(string const dir, string const start, vector<long long> &counts){
+    ifstream in((dir + "/histogram.txt").c_str());
+    string hash, key, state;
+    if (!(in >> hash >> key >> state) || state != start) {
+        return false;
+    }
+    int depth;
+    long long count;
+    while (in >> depth >> count) {
+        counts.push_back(count);
+    }
+    return !counts.empty();
+}
+
+
+int main(int argc, char **argv){
+    string start = "123456780";
+    string dir = "bfs_layers";
+    long long memoryStates = 1 << 22;
+    int maxDepth = 1000;
+    bool symmetric = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--symmetric") {
+            symmetric = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return 1;
+        }
+        if (arg == "--start") {
+            start = argv[++i];
+        } else if (arg == "--dir") {
+            dir = argv[++i];
+        } else if (arg == "--memory") {
+            memoryStates = atoll(argv[++i]);
+        } else if (arg == "--max-depth") {
+            maxDepth = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    if (!validPattern(start)) {
+        fprintf(stderr, "Start state must be a 3x3 or 4x4 board with exactly one blank\n");
+        return 1;
+    }
+    if (memoryStates < 16) {
+        memoryStates = 16;
+    }
+    int width = start.length() == 9 ? 3 : 4;
+    BoardSymmetry symmetry(packBoard(start), width);
+    if (symmetric && !symmetry.available()) {
+        fprintf(stderr, "--symmetric needs a start state with distinct tiles and its blank on the main diagonal\n");
+        return 1;
+    }
+    // Checkpoints from symmetric and plain runs hold different layers, so they are kept apart
+    string checkpointKey = symmetric ? start + "/symmetric" : start;
+    mkdir(dir.c_str(), 0755);
+
+    vector<long long> counts;
+    if (readHistogram(dir, checkpointKey, counts)) {
+        fprintf(stderr, "Resuming after depth %d\n", (int)counts.size() - 1);
+        removeStaleRuns(dir);
+    } else {
+        LayerWriter root(layerName(dir, 0));
+        root.put(packBoard(start));
+        counts.assign(1, 1);
+        if (!root.close() || !writeHistogram(dir, checkpointKey, counts)) {
+            fprintf(stderr, "Cannot write to %s\n", dir.c_str());
+            return 1;
+        }
+    }
+
+    vector<packedBoard> buffer;
+    buffer.reserve(memoryStates);
+
+    for (int depth = (int)counts.size() - 1; depth < maxDepth && counts[depth] > 0; depth++) {
+        // Expand layer `depth` into sorted runs
+        vector<string> runs;
+        bool written = true;
+        LayerReader layer(layerName(dir, depth));
+        for (; layer.valid && written; layer.next()) {
+            packedBoard next[4];
+            char moves[4];
+            int n = boardSuccessors(layer.current, width, next, moves);
+            for (int i = 0; i < n; i++) {
+                buffer.push_back(symmetric ? symmetry.canonical(next[i]) : next[i]);
+            }
+            if ((long long)buffer.size() + 4 > memoryStates) {
+                runs.push_back(runName(dir, 0, runs.size()));
+                written = flushRun(buffer, runs.back());
+            }
+        }
+        if (written && (!buffer.empty() || runs.empty())) {
+            runs.push_back(runName(dir, 0, runs.size()));
+            written = flushRun(buffer, runs.back());
+        }
+
+        // Reduce the number of runs until one merge can take them all
+        for (int pass = 1; written && (int)runs.size() > MAX_MERGE_FANIN; pass++) {
+            vector<string> merged;
+            for (size_t i = 0; i < runs.size(); i += MAX_MERGE_FANIN) {
+                vector<string> group(runs.begin() + i, runs.begin() + min(runs.size(), i + MAX_MERGE_FANIN));
+                merged.push_back(runName(dir, pass, merged.size()));
+                written = written && mergeRuns(group, merged.back(), vector<string>()) >= 0;
+                for (string const &name : group) {
+                    remove(name.c_str());
+                }
+            }
+            runs.swap(merged);
+        }
+
+        // Final merge with delayed duplicate detection against layers depth and depth - 1
+        vector<string> excludes(1, layerName(dir, depth));
+        if (depth > 0) {
+            excludes.push_back(layerName(dir, depth - 1));
+        }
+        string tmp = layerName(dir, depth + 1) + ".tmp";
+        long long count = written ? mergeRuns(runs, tmp, excludes) : -1;
+        for (string const &name : runs) {
+            remove(name.c_str());
+        }
+
+        if (count == 0) {
+            remove(tmp.c_str());
+        } else if (count < 0 || rename(tmp.c_str(), layerName(dir, depth + 1).c_str()) != 0) {
+            // The checkpoint still ends at `depth`, so a rerun redoes this layer
+            remove(tmp.c_str());
+            fprintf(stderr, "Cannot write layer %d to %s\n", depth + 1, dir.c_str());
+            return 1;
+        }
+        counts.push_back(count);
+        if (!writeHistogram(dir, checkpointKey, counts)) {
+            fprintf(stderr, "Cannot update %s/histogram.txt after layer %d\n", dir.c_str(), depth + 1);
+            return 1;
+        }
+        fprintf(stderr, "Depth %d: %lld states\n", depth + 1, count);
+    }
+
+    long long total = 0;
+    for (long long c : counts) {
+        total += c;
+    }
+    fprintf(stderr, "Enumerated %lld states in %d layers\n", total, (int)counts.size());
+    return 0;
+}
@@ -0,0 +1,291 @@
+// File: generator.cpp
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Native command-line tool that writes puzzle instances with an exact optimal solution length,
+//              for load testing the solvers with chosen difficulty mixes.
+//
+// Build: g++ -O2 -std=c++17 -pthread generator.cpp board.cpp statetable.cpp algorithm.cpp puzzle.cpp symmetry.cpp -o generator
+//
+// Usage: generator [--goal STATE] [--seed N] [--depths D:COUNT[,D:COUNT...]] [--out PREFIX] [--attempts N]
+//                  [--max-expansions N]
+//
+//   3x3 goals: every instance is drawn uniformly from the states at exactly depth D of an exhaustive
+//              distance table built from the goal (parallelDistanceTable). The table holds one entry per
+//              transpose-symmetry class (SymmetricIndexer); both members of a class are candidates.
+//   4x4 goals: instances come from seeded random walks away from the goal; a walk is kept only when
+//              A* (Manhattan distance) confirms its optimal length is exactly D. Verified lengths are cached
+//              under the symmetry-canonical query, so a walk ending on a mirror image of an earlier one is
+//              not searched again. A walk that A* cannot
+//              verify within --max-expansions (default 2000000) is rejected like any other failed attempt,
+//              so memory stays bounded; in practice that limits 4x4 depths to roughly 40-50.
+//
+// Output: PREFIX.bin (binary corpus, little-endian) and PREFIX.txt (one "state depth" line per instance).
+//   Binary layout:
+//     char     magic[4]   "PZC1"
+//     uint8    width
+//     uint8    reserved[3]
+//     uint64   goal       packed board, 4 bits per cell (see board.h)
+//     uint64   seed
+//     uint32   count
+//     count x { uint64 board; uint8 depth; }
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "algorithm.h"
+#include "board.h"
+#include "parallelbfs.h"
+#include "symmetry.h"
+
+using namespace std;
+
+
+// A requested bucket of the depth distribution.
+struct DepthRequest {
+    int depth;
+    int count;
+};
+
+
+// Purpose: Parses "D:COUNT[,D:COUNT...]" into depth requests.
+// Returns: False if the specification is malformed
+static bool parseDepths(string const spec, vector<DepthRequest> &requests){
+    size_t pos = 0;
+    while (pos < spec.length()) {
+        size_t end = spec.find(',', pos);
+        if (end == string::npos) {
+            end = spec.length();
+        }
+        string item = spec.substr(pos, end - pos);
+        size_t colon = item.find(':');
+        if (colon == string::npos) {
+            return false;
+        }
+        DepthRequest r = {atoi(item.substr(0, colon).c_str()), atoi(item.substr(colon + 1).c_str())};
+        if (r.depth < 0 || r.count < 0) {
+            return false;
+        }
+        requests.push_back(r);
+        pos = end + 1;
+    }
+    return !requests.empty();
+}
+
+
+// Purpose: Draws count distinct states at exactly the requested depth from the 3x3 class table,
+//          skipping states already drawn for an earlier bucket of the same depth.
+static void sampleFromTable(SymmetricIndexer &indexer, vector<unsigned char> const &distance, DepthRequest const &request,
+                            mt19937_64 &rng, set<packedBoard> &seen, vector<packedBoard> &out){
+    vector<packedBoard> bucket;
+    for (long long c = 0; c < (long long)distance.size(); c++) {
+        if (distance[c] != request.depth) {
+            continue;
+        }
+        packedBoard members[2];
+        int n = indexer.members(indexer.unrank(c), members);
+        for (int i = 0; i < n; i++) {
+            if (!seen.count(members[i])) {
+                bucket.push_back(members[i]);
+            }
+        }
+    }
+
+    int count = request.count;
+    if (count > (int)bucket.size()) {
+        fprintf(stderr, "Depth %d has only %d states left; writing all of them\n", request.depth, (int)bucket.size());
+        count = (int)bucket.size();
+    }
+
+    // Partial Fisher-Yates: the first count entries become a uniform sample without replacement
+    for (int i = 0; i < count; i++) {
+        uniform_int_distribution<long long> pick(i, bucket.size() - 1);
+        swap(bucket[i], bucket[pick(rng)]);
+        seen.insert(bucket[i]);
+        out.push_back(bucket[i]);
+    }
+}
+
+
+// Purpose: Random walk of the given length that never immediately undoes its previous move.
+static packedBoard randomWalk(packedBoard start, int width, int length, mt19937_64 &rng){
+    packedBoard board = start;
+    char last = 0;
+    for (int step = 0; step < length; step++) {
+        packedBoard next[4];
+        char moves[4];
+        int n = boardSuccessors(board, width, next, moves);
+        int choice;
+        do {
+            choice = uniform_int_distribution<int>(0, n - 1)(rng);
+        } while (last != 0 && moves[choice] == inverseMove(last));
+        board = next[choice];
+        last = moves[choice];
+    }
+    return board;
+}
+
+
+// Returns: Optimal solution length from board to goal according to A* with Manhattan distance,
+//          or -1 if A* gives up after maxExpansions expansions
+static int optimalLength(packedBoard board, string const goal, int maxExpansions){
+    int pathLength = 0, numOfStateExpansions = 0, maxQLength = 0;
+    float actualRunningTime = 0.0;
+    int numOfDeletions = 0, numOfLocalLoops = 0, numOfReExpansions = 0;
+
+    string path = aStar_ExpandedList(unpackBoard(board, goal.length()), goal, pathLength, numOfStateExpansions, maxQLength,
+                                     actualRunningTime, numOfDeletions, numOfLocalLoops, numOfReExpansions, manhattanDistance,
+                                     maxExpansions);
+    return path.empty() && board != packBoard(goal) ? -1 : pathLength;
+}
+
+
+// Purpose: Collects count distinct 4x4 states whose solver-verified optimal length is exactly request.depth.
+// Walks start at the target length and are lengthened by the shortfall whenever the walk folds back on itself.
+// lengths caches every verification (-1 for a budget failure) under the canonical query.
+static void sampleFromWalks(packedBoard goal, string const goalState, int width, DepthRequest const &request, int attempts,
+                            int maxExpansions, mt19937_64 &rng, set<packedBoard> &seen,
+                            map<CanonicalQuery, int> &lengths, vector<packedBoard> &out){
+    int walkLength = request.depth;
+    int accepted = 0;
+
+    for (int tries = 0; accepted < request.count && tries < request.count * attempts; tries++) {
+        packedBoard board = randomWalk(goal, width, walkLength, rng);
+        if (seen.count(board)) {
+            continue;
+        }
+
+        CanonicalQuery query = canonicalQuery(board, goal, width);
+        map<CanonicalQuery, int>::iterator cached = lengths.find(query);
+        int length = cached != lengths.end() ? cached->second : optimalLength(board, goalState, maxExpansions);
+        lengths[query] = length;
+        if (length < 0) {
+            continue; // Too hard to verify within the budget
+        }
+        if (length == request.depth) {
+            seen.insert(board);
+            out.push_back(board);
+            accepted++;
+        } else if (length < request.depth && walkLength < request.depth * 4) {
+            walkLength += request.depth - length;
+        }
+    }
+
+    if (accepted < request.count) {
+        fprintf(stderr, "Depth %d: only %d of %d instances found within the attempt limit\n",
+                request.depth, accepted, request.count);
+    }
+}
+
+
+static void writeLE(ofstream &out, unsigned long long value, int bytes){
+    for (int i = 0; i < bytes; i++) {
+        out.put((char)((value >> (8 * i)) & 0xFF));
+    }
+}
+
+
+int main(int argc, char **argv){
+    string goal = "123456780";
+    string depthSpec = "10:10,20:10,31:2";
+    string prefix = "corpus";
+    unsigned long long seed = 1;
+    int attempts = 50;
+    int maxExpansions = 2000000;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return 1;
+        }
+        if (arg == "--goal") {
+            goal = argv[++i];
+        } else if (arg == "--seed") {
+            seed = strtoull(argv[++i], NULL, 10);
+        } else if (arg == "--depths") {
+            depthSpec = argv[++i];
+        } else if (arg == "--out") {
+            prefix = argv[++i];
+        } else if (arg == "--attempts") {
+            attempts = atoi(argv[++i]);
+        } else if (arg == "--max-expansions") {
+            maxExpansions = max(atoi(argv[++i]), 1);
+        } else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    vector<DepthRequest> requests;
+    if (!parseDepths(depthSpec, requests)) {
+        fprintf(stderr, "Invalid --depths specification: %s\n", depthSpec.c_str());
+        return 1;
+    }
+    if (!validBoard(goal)) {
+        fprintf(stderr, "Goal must be a 3x3 or 4x4 board holding each tile exactly once\n");
+        return 1;
+    }
+
+    int cells = (int)goal.length();
+    int width = cells == 9 ? 3 : 4;
+    packedBoard goalBoard = packBoard(goal);
+    mt19937_64 rng(seed);
+    vector<packedBoard> boards;
+    vector<int> depths;
+
+    set<packedBoard> seen;
+    if (width == 3) {
+        SymmetricIndexer indexer(goal);
+        vector<unsigned char> distance;
+        parallelDistanceTable(indexer, goalBoard, (int)thread::hardware_concurrency(), distance);
+        for (DepthRequest const &r : requests) {
+            size_t before = boards.size();
+            sampleFromTable(indexer, distance, r, rng, seen, boards);
+            depths.insert(depths.end(), boards.size() - before, r.depth);
+        }
+    } else {
+        map<CanonicalQuery, int> lengths;
+        for (DepthRequest const &r : requests) {
+            size_t before = boards.size();
+            sampleFromWalks(goalBoard, goal, width, r, attempts, maxExpansions, rng, seen, lengths, boards);
+            depths.insert(depths.end(), boards.size() - before, r.depth);
+        }
+    }
+
+    ofstream bin((prefix + ".bin").c_str(), ios::binary);
+    ofstream txt((prefix + ".txt").c_str());
+    if (!bin || !txt) {
+        fprintf(stderr, "Cannot open %s.bin / %s.txt for writing\n", prefix.c_str(), prefix.c_str());
+        return 1;
+    }
+
+    bin.write("PZC1", 4);
+    writeLE(bin, width, 1);
+    writeLE(bin, 0, 3);
+    writeLE(bin, goalBoard, 8);
+    writeLE(bin, seed, 8);
+    writeLE(bin, boards.size(), 4);
+    txt << "# width " << width << " goal " << goal << " seed " << seed << "\n";
+
+    for (size_t i = 0; i < boards.size(); i++) {
+        writeLE(bin, boards[i], 8);
+        writeLE(bin, depths[i], 1);
+        txt << unpackBoard(boards[i], cells) << " " << depths[i] << "\n";
+    }
+    bin.close();
+    txt.close();
+    if (bin.fail() || txt.fail()) {
+        fprintf(stderr, "Cannot write %s.bin / %s.txt\n", prefix.c_str(), prefix.c_str());
+        return 1;
+    }
+
+    fprintf(stderr, "Wrote %d instances to %s.bin and %s.txt\n", (int)boards.size(), prefix.c_str(), prefix.c_str());
+    return 0;
+}
@@ -0,0 +1,107 @@
+// File: parallelbfs.h
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Multi-threaded, level-synchronous breadth-first search that builds exhaustive distance tables.
+
+#ifndef __PARALLELBFS_H__
+#define __PARALLELBFS_H__
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "board.h"
+
+using namespace std;
+
+// Distance value for ranks that are not reachable from the goal.
+const unsigned char UNREACHED = 0xFF;
+
+///////////////////////////////////////////////////////////////////////////////////////////
+//
+// Purpose: Computes the distance from goal to every reachable state, one BFS layer at a time.
+//          Each layer is cut into chunks that threads claim dynamically; a successor is claimed by
+//          whichever thread first sets its bit in a rank-indexed atomic bitset, so each state is
+//          written to the distance array and the next layer exactly once without locks.
+//
+// Params:
+//   - indexer: StateIndexer, PatternIndexer or SymmetricIndexer for the goal (rank, unrank, size, getWidth)
+//   - goal: Packed goal board
+//   - threads: Worker threads per layer (at least 1)
+//   - distance: Output, one byte per rank; UNREACHED if the rank is never reached
+//
+// Returns: Number of states at each depth
+//
+////////////////////////////////////////////////////////////////////////////////////////////
+template <class Indexer>
+vector<long long> parallelDistanceTable(Indexer &indexer, packedBoard goal, int threads, vector<unsigned char> &distance){
+    const long long CHUNK = 4096;
+    long long size = indexer.size();
+    int width = indexer.getWidth();
+
+    vector<atomic<unsigned long long> > visited((size + 63) / 64);
+    for (atomic<unsigned long long> &word : visited) {
+        word.store(0, memory_order_relaxed);
+    }
+    distance.assign(size, UNREACHED);
+
+    vector<long long> frontier(1, indexer.rank(goal));
+    visited[frontier[0] / 64].fetch_or(1ULL << (frontier[0] % 64));
+    distance[frontier[0]] = 0;
+    vector<long long> counts(1, 1);
+
+    threads = max(threads, 1);
+    vector<vector<long long> > localNext(threads);
+
+    for (int depth = 0; !frontier.empty(); depth++) {
+        atomic<long long> nextChunk(0);
+        unsigned char childDepth = (unsigned char)min(depth + 1, (int)UNREACHED - 1);
+
+        auto expand = [&](int id) {
+            vector<long long> &out = localNext[id];
+            out.clear();
+            for (long long begin = nextChunk.fetch_add(CHUNK); begin < (long long)frontier.size(); begin = nextChunk.fetch_add(CHUNK)) {
+                long long end = min(begin + CHUNK, (long long)frontier.size());
+                for (long long i = begin; i < end; i++) {
+                    packedBoard next[4];
+                    char moves[4];
+                    int n = boardSuccessors(indexer.unrank(frontier[i]), width, next, moves);
+                    for (int k = 0; k < n; k++) {
+                        long long r = indexer.rank(next[k]);
+                        unsigned long long bit = 1ULL << (r % 64);
+                        if (visited[r / 64].load(memory_order_relaxed) & bit) {
+                            continue;
+                        }
+                        if (!(visited[r / 64].fetch_or(bit) & bit)) {
+                            distance[r] = childDepth;
+                            out.push_back(r);
+                        }
+                    }
+                }
+            }
+        };
+
+        // Small layers are not worth waking the other threads for
+        int active = frontier.size() < (size_t)CHUNK ? 1 : threads;
+        vector<thread> pool;
+        for (int id = 1; id < active; id++) {
+            pool.push_back(thread(expand, id));
+        }
+        expand(0);
+        for (thread &t : pool) {
+            t.join();
+        }
+
+        frontier.clear();
+        for (int id = 0; id < active; id++) {
+            frontier.insert(frontier.end(), localNext[id].begin(), localNext[id].end());
+        }
+        if (!frontier.empty()) {
+            counts.push_back(frontier.size());
+        }
+    }
+    return counts;
+}
+
+#endif
@@ -0,0 +1,39 @@
+// File: platform.h
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Lets the solver sources build natively as well as under Emscripten.
+
+#ifndef __PLATFORM_H__
+#define __PLATFORM_H__
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#else
+// Native builds (generator and other command-line tools) drop the browser console logging.
+#define EM_LOG_CONSOLE 0
+#define emscripten_log(flags, ...) ((void)0)
+#endif
+
+// Per-solve timer. Natively clock() is the CPU time of the whole process, which counts every busy worker
+// thread of a multi-threaded tool, so native builds measure elapsed time on a monotonic clock instead.
+#ifdef __EMSCRIPTEN__
+#include <ctime>
+typedef clock_t solverTime;
+inline solverTime solverClock(){
+    return clock();
+}
+inline float secondsSince(solverTime start){
+    return (float)(clock() - start) / CLOCKS_PER_SEC;
+}
+#else
+#include <chrono>
+typedef std::chrono::steady_clock::time_point solverTime;
+inline solverTime solverClock(){
+    return std::chrono::steady_clock::now();
+}
+inline float secondsSince(solverTime start){
+    return std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+}
+#endif
+
+#endif
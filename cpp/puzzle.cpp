@@ -6,48 +6,36 @@
 #include "puzzle.h"
 #include  <cmath>
 #include  <assert.h>
-#include <emscripten.h>
+#include "platform.h"
 
 using namespace std;
 
-//////////////////////////////////////////////////////////////
-//Constructor: Creates a deep copy of an existing Puzzle object.
-//////////////////////////////////////////////////////////////
-Puzzle::Puzzle(const Puzzle &p) : path(p.path){
-
-	for(int i=0; i < 3; i++){
-		for(int j=0; j < 3; j++){
-		    board[i][j] = p.board[i][j];
-		    goalBoard[i][j] = p.goalBoard[i][j];
-		}
-	}
-
-	x0 = p.x0;
-	y0 = p.y0;
-	//path = p.path;
-	pathLength = p.pathLength;
-	hCost = p.hCost;
-	fCost = p.fCost;
-	strBoard = toString(); //uses the board contents to generate the string equivalent
-	depth = p.depth;
-
-}
-
 //////////////////////////////////////////////////////////////
 //Constructor: Puzzle
 //Purpose: Initializes a new Puzzle from initial and goal state strings.
 // Params:
 //   - elements: Initial state (e.g., "123804765")
 //   - goal: Goal state (e.g., "123456780")
+// Boards up to 4x4 are supported; the width is the square root of the
+// string length and tiles above 9 use the characters following '9' (":;<=>?").
+// Callers validate the strings (see validBoard); malformed input is clamped to the board, never read or written
+// out of bounds.
 //////////////////////////////////////////////////////////////
 Puzzle::Puzzle(string const elements, string const goal){
     emscripten_log(EM_LOG_CONSOLE, "Constructing Puzzle with elements: %s, goal: %s", elements.c_str(), goal.c_str());
 	int n;
 
+	x0 = 0;
+	y0 = 0;
+	width = 1;
+	while(width * width < (int)elements.length() && width < MAX_BOARD_WIDTH){
+	    width++;
+	}
+
 	n = 0;
-	for(int i=0; i < 3; i++){
-		for(int j=0; j < 3; j++){
-		    board[i][j] = elements[n] - '0';
+	for(int i=0; i < width; i++){
+		for(int j=0; j < width; j++){
+		    board[i][j] = n < (int)elements.length() ? (elements[n] - '0') & 0xF : 0;
 		    if(board[i][j] == 0){
 			    x0 = j;
 			    y0 = i;
@@ -58,9 +46,11 @@ Puzzle::Puzzle(string const elements, string const goal){
 
 	///////////////////////
 	n = 0;
-	for(int i=0; i < 3; i++){
-		for(int j=0; j < 3; j++){
-		    goalBoard[i][j] = goal[n] - '0';
+	for(int i=0; i < width; i++){
+		for(int j=0; j < width; j++){
+		    goalBoard[i][j] = n < (int)goal.length() ? (goal[n] - '0') & 0xF : 0;
+		    goalX[goalBoard[i][j]] = j;
+		    goalY[goalBoard[i][j]] = i;
 		    n++;
 		}
 	}
@@ -113,8 +103,8 @@ int Puzzle::h(heuristicFunction hFunction){
 
 	switch(hFunction){
 		case misplacedTiles:
-            for (int i = 0; i < 3; i++) {
-                for (int j= 0; j < 3; j++) {
+            for (int i = 0; i < width; i++) {
+                for (int j= 0; j < width; j++) {
                     if (board[i][j] != 0 && board[i][j] != goalBoard[i][j]) {
                         h++;
                     }
@@ -124,16 +114,10 @@ int Puzzle::h(heuristicFunction hFunction){
 
 
 		case manhattanDistance:
-		        for (int i = 0; i < 3; i++) {
-                for (int j = 0; j< 3; j++) {
+		        for (int i = 0; i < width; i++) {
+                for (int j = 0; j< width; j++) {
                     if (board[i][j] != 0) {
-                        for (int m =0; m< 3; m++) {
-                            for (int n =0; n < 3; n++) {
-                                if (board[i][j] == goalBoard[m][n]) {
-                                    h += abs(i - m) + abs(j- n);
-                                }
-                            }
-                        }
+                        h += abs(i - goalY[board[i][j]]) + abs(j - goalX[board[i][j]]);
                     }
                 }
             }
@@ -147,14 +131,14 @@ int Puzzle::h(heuristicFunction hFunction){
 
 
 //Converts current board state to a string for comparison.
-// Returns: 9-digit string (e.g., "123456780")
+// Returns: One character per cell (e.g., "123456780" for a 3x3 board)
 string Puzzle::toString(){
   int n;
   string stringPath;
 
   n=0;
-  for(int i=0; i < 3; i++){
-		for(int j=0; j < 3; j++){
+  for(int i=0; i < width; i++){
+		for(int j=0; j < width; j++){
 		    stringPath.insert(stringPath.end(), board[i][j] + '0');
 		    n++;
 		}
@@ -166,8 +150,8 @@ string Puzzle::toString(){
 }
 
 bool Puzzle::goalMatch() {
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 3; j++) {
+    for (int i = 0; i < width; i++) {
+        for (int j = 0; j < width; j++) {
             if (board[i][j] != goalBoard[i][j]) {
                 return false;
             }
@@ -187,7 +171,7 @@ const string Puzzle::getPath(){
 
 bool Puzzle::canMoveRight(){
 
-   return (x0 < 2);
+   return (x0 < width - 1);
 
 }
 
@@ -200,7 +184,7 @@ bool Puzzle::canMoveUp(){
 
 bool Puzzle::canMoveDown(){
 
-   return (y0 < 2);
+   return (y0 < width - 1);
 
 }
 
@@ -267,7 +251,7 @@ Puzzle *Puzzle::moveRight(){
    Puzzle *p = new Puzzle(*this);
 
 
-   if(x0 < 2){
+   if(x0 < width - 1){
 
 		p->board[y0][x0] = p->board[y0][x0+1];
 		p->board[y0][x0+1] = 0;
@@ -317,7 +301,7 @@ Puzzle *Puzzle::moveDown(){
    Puzzle *p = new Puzzle(*this);
 
 
-   if(y0 < 2){
+   if(y0 < width - 1){
 
 		p->board[y0][x0] = p->board[y0+1][x0];
 		p->board[y0+1][x0] = 0;
@@ -341,8 +325,8 @@ Puzzle *Puzzle::moveDown(){
 
 void Puzzle::printBoard(){
 	cout << "board: "<< endl;
-	for(int i=0; i < 3; i++){
-		for(int j=0; j < 3; j++){
+	for(int i=0; i < width; i++){
+		for(int j=0; j < width; j++){
 		  cout << endl << "board[" << i << "][" << j << "] = " << board[i][j];
 		}
 	}
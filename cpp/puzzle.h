@@ -3,6 +3,9 @@
 // Date: March 24, 2025
 // Description: Header file defining the Puzzle class for 8-puzzle state management.
 
+#ifndef __PUZZLE_H__
+#define __PUZZLE_H__
+
 #include <string>
 #include <iostream>
 
@@ -11,6 +14,10 @@ using namespace std;
 
 enum heuristicFunction{misplacedTiles, manhattanDistance};
 
+// Largest supported board is 4x4 (the 15-puzzle); the width is taken from the state string length.
+const int MAX_BOARD_WIDTH = 4;
+const int MAX_BOARD_CELLS = MAX_BOARD_WIDTH * MAX_BOARD_WIDTH;
+
 
 class Puzzle{
 
@@ -22,18 +29,20 @@ private:
     int fCost;
     int depth;
 
-    int goalBoard[3][3];
+    int width;
+
+    int goalBoard[MAX_BOARD_WIDTH][MAX_BOARD_WIDTH];
+    int goalX[MAX_BOARD_CELLS], goalY[MAX_BOARD_CELLS]; // Goal column/row of every tile, for Manhattan distance
 
     int x0, y0;
 
-    int board[3][3];
+    int board[MAX_BOARD_WIDTH][MAX_BOARD_WIDTH];
 
 public:
 
     string strBoard;
 
 
-    Puzzle(const Puzzle &p);
     Puzzle(string const elements, string const goal);
 
     void printBoard();
@@ -53,6 +62,10 @@ public:
         return strBoard;
      }
 
+    int getWidth(){
+        return width;
+    }
+
     bool canMoveLeft();
     bool canMoveRight();
     bool canMoveUp();
@@ -80,3 +93,5 @@ public:
     int getGCost();
 
 };
+
+#endif
@@ -0,0 +1,439 @@
+// File: solverd.cpp
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Long-running native solver service. Accepts requests over a local Unix socket or a loopback
+//              TCP port, micro-batches them onto a pool of worker threads and reports service counters.
+//
+// Build: g++ -O2 -std=c++17 -pthread solverd.cpp algorithm.cpp puzzle.cpp board.cpp statetable.cpp -o solverd
+//
+// Usage: solverd [--socket PATH | --port N] [--workers N] [--batch N] [--batch-wait-us N] [--cache N]
+//                [--max-expansions N]
+//
+// Protocol: newline-delimited text, any number of requests per connection, replies in completion order.
+//   Request:  <id> <start> <goal> <algorithm> <heuristic> <budget>
+//               algorithm  uc | astar | frontier
+//               heuristic  0 misplaced tiles, 1 Manhattan distance (ignored by uc)
+//               budget     maximum state expansions, 0 for no limit. 4x4 and uc requests are held to
+//                          --max-expansions (default 2000000, 0 for none) when the budget is 0 or larger
+//   Reply:    <id> <status> <pathLength> <numOfStateExpansions> <maxQLength> <timeMs> <path>
+//               status     ok | unsolvable | budget | error
+//                          unsolvable is decided from permutation parity before any search
+//               The four numbers are the stats array returned by wrapper.cpp; path is "-" when empty.
+//   STATS     Replies "stats completed=N queue=N throughput=R/s p50=Xms p90=Xms p99=Xms", latencies over
+//             the most recent requests, measured from arrival to reply.
+//
+// Each worker keeps warm state between requests: the solvers' thread-local state tables and a result
+// cache keyed on the exact query, so repeats are answered from the cache with the stats of the original
+// solve. Identical queries within a batch are solved once. Symmetric forms of a query (see symmetry.h) are
+// not shared: they have the same path length but different expansion counts, and the counts are part of the reply.
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "algorithm.h"
+#include "board.h"
+
+using namespace std;
+
+typedef chrono::steady_clock serviceClock;
+
+
+// A client connection; the socket is closed once the reader and every pending request have let go of it.
+struct Connection {
+    int fd;
+    mutex writeLock;
+
+    Connection(int f) : fd(f) {}
+    ~Connection() {
+        close(fd);
+    }
+
+    void send(string const &line){
+        lock_guard<mutex> lock(writeLock);
+        size_t sent = 0;
+        while (sent < line.length()) {
+            ssize_t n = ::send(fd, line.data() + sent, line.length() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                return;
+            }
+            sent += n;
+        }
+    }
+};
+
+struct Request {
+    shared_ptr<Connection> connection;
+    string id;
+    string start;
+    string goal;
+    string algorithm;
+    int heuristic;
+    int budget;
+    serviceClock::time_point received;
+};
+
+// Solver output for one query.
+struct SolveResult {
+    string status;
+    string path;
+    int pathLength;
+    int numOfStateExpansions;
+    int maxQLength;
+    int timeMs;
+};
+
+
+// FIFO of pending requests that hands workers several at a time.
+class RequestQueue{
+
+private:
+
+    mutex lock;
+    condition_variable ready;
+    deque<Request> pending;
+
+public:
+
+    void push(Request const &r){
+        {
+            lock_guard<mutex> guard(lock);
+            pending.push_back(r);
+        }
+        ready.notify_one();
+    }
+
+    int size(){
+        lock_guard<mutex> guard(lock);
+        return (int)pending.size();
+    }
+
+    // Purpose: Blocks until work is available, then waits up to batchWait for the batch to fill.
+    // Returns: Between 1 and maxBatch requests
+    vector<Request> popBatch(int maxBatch, chrono::microseconds batchWait){
+        unique_lock<mutex> guard(lock);
+        ready.wait(guard, [&] { return !pending.empty(); });
+        if ((int)pending.size() < maxBatch && batchWait.count() > 0) {
+            ready.wait_for(guard, batchWait, [&] { return (int)pending.size() >= maxBatch; });
+        }
+
+        int n = min(maxBatch, (int)pending.size());
+        vector<Request> batch(pending.begin(), pending.begin() + n);
+        pending.erase(pending.begin(), pending.begin() + n);
+        if (!pending.empty()) {
+            ready.notify_one(); // Leftovers go to another worker straight away
+        }
+        return batch;
+    }
+
+};
+
+
+// Service counters: completion count, throughput and a window of recent latencies for percentiles.
+class ServiceStats{
+
+private:
+
+    static const int WINDOW = 8192;
+
+    mutex lock;
+    vector<double> latencies; // Ring buffer of the last WINDOW latencies, in milliseconds
+    long long completed;
+    serviceClock::time_point started;
+
+public:
+
+    ServiceStats() : latencies(WINDOW, 0.0), completed(0), started(serviceClock::now()) {}
+
+    void record(serviceClock::time_point received){
+        double ms = chrono::duration<double, milli>(serviceClock::now() - received).count();
+        lock_guard<mutex> guard(lock);
+        latencies[completed % WINDOW] = ms;
+        completed++;
+    }
+
+    string report(int queueDepth){
+        vector<double> window;
+        long long done;
+        {
+            lock_guard<mutex> guard(lock);
+            done = completed;
+            window.assign(latencies.begin(), latencies.begin() + min<long long>(completed, WINDOW));
+        }
+        sort(window.begin(), window.end());
+
+        double seconds = chrono::duration<double>(serviceClock::now() - started).count();
+        auto percentile = [&](double p) {
+            return window.empty() ? 0.0 : window[min(window.size() - 1, (size_t)(p * window.size()))];
+        };
+
+        char line[256];
+        snprintf(line, sizeof(line), "stats completed=%lld queue=%d throughput=%.1f/s p50=%.3fms p90=%.3fms p99=%.3fms\n",
+                 done, queueDepth, seconds > 0 ? done / seconds : 0.0, percentile(0.50), percentile(0.90), percentile(0.99));
+        return line;
+    }
+
+};
+
+
+static RequestQueue requestQueue;
+static ServiceStats serviceStats;
+static int expansionCeiling = 2000000; // See --max-expansions
+
+
+// Returns: Cache key for a query under one solver configuration
+static string cacheKey(Request const &r){
+    return r.algorithm + "/" + to_string(r.algorithm == "uc" ? 0 : r.heuristic) + "/" + r.start + "/" + r.goal;
+}
+
+// Purpose: Runs the requested solver on a query.
+static SolveResult solveRequest(Request const &r){
+    int width = r.start.length() == 9 ? 3 : 4;
+    if (boardParity(packBoard(r.start), width) != boardParity(packBoard(r.goal), width)) {
+        SolveResult unsolvable = {"unsolvable", "", 0, 0, 0, 0};
+        return unsolvable;
+    }
+    heuristicFunction heuristic = r.heuristic == 0 ? misplacedTiles : manhattanDistance;
+
+    int pathLength = 0, numOfStateExpansions = 0, maxQLength = 0;
+    float actualRunningTime = 0.0;
+    int numOfDeletions = 0, numOfLocalLoops = 0, numOfReExpansions = 0;
+    string path;
+
+    if (r.algorithm == "uc") {
+        path = uc_explist(r.start, r.goal, pathLength, numOfStateExpansions, maxQLength, actualRunningTime,
+                          numOfDeletions, numOfLocalLoops, numOfReExpansions, r.budget);
+    } else if (r.algorithm == "astar") {
+        path = aStar_ExpandedList(r.start, r.goal, pathLength, numOfStateExpansions, maxQLength, actualRunningTime,
+                                  numOfDeletions, numOfLocalLoops, numOfReExpansions, heuristic, r.budget);
+    } else {
+        path = frontier_bfhs(r.start, r.goal, pathLength, numOfStateExpansions, maxQLength, actualRunningTime,
+                             numOfDeletions, numOfLocalLoops, numOfReExpansions, heuristic, r.budget);
+    }
+
+    SolveResult result = {"ok", path, pathLength, numOfStateExpansions, maxQLength, static_cast<int>(actualRunningTime * 1000)};
+    if (path.empty() && r.start != r.goal) {
+        result.pathLength = 0;
+        result.status = "budget";
+    }
+    return result;
+}
+
+static string formatReply(Request const &r, SolveResult const &result){
+    ostringstream line;
+    line << r.id << " " << result.status << " " << result.pathLength << " " << result.numOfStateExpansions << " "
+         << result.maxQLength << " " << result.timeMs << " " << (result.path.empty() ? "-" : result.path) << "\n";
+    return line.str();
+}
+
+
+// Purpose: Worker loop. Takes batches, groups identical queries, answers from the warm cache where
+//          possible and solves each remaining distinct query once.
+static void workerLoop(int maxBatch, chrono::microseconds batchWait, size_t cacheCapacity){
+    unordered_map<string, SolveResult> cache;
+    deque<string> cacheOrder; // Insertion order, for evicting the oldest entry
+
+    while (true) {
+        vector<Request> batch = requestQueue.popBatch(maxBatch, batchWait);
+
+        map<string, vector<Request *> > groups;
+        for (Request &r : batch) {
+            groups[cacheKey(r)].push_back(&r);
+        }
+
+        for (auto &group : groups) {
+            Request const &first = *group.second[0];
+            SolveResult result;
+
+            unordered_map<string, SolveResult>::iterator hit = cache.find(group.first);
+            if (hit != cache.end()) {
+                result = hit->second;
+            } else {
+                // Solve once under the most generous budget in the group (0 = unlimited)
+                Request widest = first;
+                for (Request *member : group.second) {
+                    if (member->budget == 0 || (widest.budget != 0 && member->budget > widest.budget)) {
+                        widest.budget = member->budget;
+                    }
+                }
+                result = solveRequest(widest);
+                // A budget failure depends on the budget, so only definitive answers are cached
+                if (result.status != "budget" && cacheCapacity > 0) {
+                    if (cache.size() >= cacheCapacity) {
+                        cache.erase(cacheOrder.front());
+                        cacheOrder.pop_front();
+                    }
+                    cache[group.first] = result;
+                    cacheOrder.push_back(group.first);
+                }
+            }
+
+            for (Request *member : group.second) {
+                Request const &r = *member;
+                SolveResult answer = result;
+                // Members with a smaller budget than the solve used must fail the way they would have alone
+                if (answer.status == "ok" && r.budget > 0 && answer.numOfStateExpansions > r.budget) {
+                    answer = solveRequest(r);
+                }
+                r.connection->send(formatReply(r, answer));
+                serviceStats.record(r.received);
+            }
+        }
+    }
+}
+
+
+// Purpose: Reads request lines from one client and queues them.
+static void connectionLoop(shared_ptr<Connection> connection){
+    string buffer;
+    char chunk[4096];
+
+    while (true) {
+        ssize_t n = recv(connection->fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) {
+            return;
+        }
+        buffer.append(chunk, n);
+
+        size_t newline;
+        while ((newline = buffer.find('\n')) != string::npos) {
+            string line = buffer.substr(0, newline);
+            buffer.erase(0, newline + 1);
+            if (!line.empty() && line[line.length() - 1] == '\r') {
+                line.erase(line.length() - 1);
+            }
+            if (line.empty()) {
+                continue;
+            }
+            if (line == "STATS") {
+                connection->send(serviceStats.report(requestQueue.size()));
+                continue;
+            }
+
+            Request r;
+            istringstream fields(line);
+            r.connection = connection;
+            r.received = serviceClock::now();
+            if (!(fields >> r.id >> r.start >> r.goal >> r.algorithm >> r.heuristic >> r.budget) ||
+                !validBoard(r.start) || !validBoard(r.goal) || r.start.length() != r.goal.length() ||
+                (r.algorithm != "uc" && r.algorithm != "astar" && r.algorithm != "frontier") || r.budget < 0) {
+                connection->send((r.id.empty() ? string("?") : r.id) + " error 0 0 0 0 -\n");
+                continue;
+            }
+            // 4x4 searches and uninformed search can exhaust memory long before finishing
+            bool bounded = r.start.length() == 9 && r.algorithm != "uc";
+            if (!bounded && expansionCeiling > 0 && (r.budget == 0 || r.budget > expansionCeiling)) {
+                r.budget = expansionCeiling;
+            }
+            requestQueue.push(r);
+        }
+    }
+}
+
+
+// Returns: Listening socket, or -1 on failure
+static int openListener(string const &socketPath, int port){
+    int fd;
+    if (!socketPath.empty()) {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        struct sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+        unlink(socketPath.c_str());
+        if (fd < 0 || bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0) {
+            return -1;
+        }
+    } else {
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = htons(port);
+        if (fd < 0 || bind(fd, (struct sockaddr *)&address, sizeof(address)) < 0) {
+            return -1;
+        }
+    }
+    return listen(fd, 128) < 0 ? -1 : fd;
+}
+
+
+int main(int argc, char **argv){
+    string socketPath;
+    int port = 7878;
+    int workers = (int)thread::hardware_concurrency();
+    int maxBatch = 16;
+    int batchWaitUs = 200;
+    int cacheCapacity = 65536;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return 1;
+        }
+        if (arg == "--socket") {
+            socketPath = argv[++i];
+        } else if (arg == "--port") {
+            port = atoi(argv[++i]);
+        } else if (arg == "--workers") {
+            workers = atoi(argv[++i]);
+        } else if (arg == "--batch") {
+            maxBatch = atoi(argv[++i]);
+        } else if (arg == "--batch-wait-us") {
+            batchWaitUs = atoi(argv[++i]);
+        } else if (arg == "--cache") {
+            cacheCapacity = atoi(argv[++i]);
+        } else if (arg == "--max-expansions") {
+            expansionCeiling = atoi(argv[++i]);
+        } else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return 1;
+        }
+    }
+    workers = max(workers, 1);
+    maxBatch = max(maxBatch, 1);
+
+    signal(SIGPIPE, SIG_IGN);
+    int listener = openListener(socketPath, port);
+    if (listener < 0) {
+        fprintf(stderr, "Cannot listen on %s\n", socketPath.empty() ? ("127.0.0.1:" + to_string(port)).c_str() : socketPath.c_str());
+        return 1;
+    }
+
+    for (int i = 0; i < workers; i++) {
+        thread(workerLoop, maxBatch, chrono::microseconds(batchWaitUs), (size_t)cacheCapacity).detach();
+    }
+    fprintf(stderr, "solverd listening on %s with %d workers\n",
+            socketPath.empty() ? ("127.0.0.1:" + to_string(port)).c_str() : socketPath.c_str(), workers);
+
+    while (true) {
+        int client = accept(listener, NULL, NULL);
+        if (client < 0) {
+            continue;
+        }
+        thread(connectionLoop, make_shared<Connection>(client)).detach();
+    }
+}
@@ -0,0 +1,97 @@
+// File: statetable.cpp
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Implements the open-addressing state table used by the solvers.
+
+#include <algorithm>
+
+#include "statetable.h"
+
+using namespace std;
+
+//////////////////////////////////////////////////////////////
+//Constructor: Sizes the slot array to a power of two with room for expectedStates at <= 50% load.
+//////////////////////////////////////////////////////////////
+StateTable::StateTable(int expectedStates){
+    size_t capacity = 16;
+    while (capacity < (size_t)expectedStates * 2) {
+        capacity <<= 1;
+    }
+    Slot empty = {0, -1, 0};
+    slots.assign(capacity, empty);
+    mask = capacity - 1;
+    generation = 1;
+    recentUse = 0;
+    entries.reserve(expectedStates);
+}
+
+void StateTable::clear(int retainStates){
+    recentUse = max(entries.size(), recentUse - recentUse / 8);
+    size_t keep = max(recentUse, (size_t)retainStates);
+    if (slots.size() > keep * 4) {
+        // Release in one step, down to what the last search needed
+        *this = StateTable((int)max(entries.size(), (size_t)retainStates));
+        return;
+    }
+    entries.clear();
+    if (++generation == 0) {
+        // Stamps wrapped around; old ones could now look current
+        Slot empty = {0, -1, 0};
+        fill(slots.begin(), slots.end(), empty);
+        generation = 1;
+    }
+}
+
+// Fibonacci hashing spreads the nibble-packed boards, whose low bits vary little between neighbours.
+size_t StateTable::slotFor(packedBoard key) const{
+    return (size_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+}
+
+int StateTable::find(packedBoard key) const{
+    for (size_t i = slotFor(key); ; i = (i + 1) & mask) {
+        const Slot &slot = slots[i];
+        if (slot.stamp != generation) {
+            return -1;
+        }
+        if (slot.key == key) {
+            return slot.entry;
+        }
+    }
+}
+
+int StateTable::insert(packedBoard key, int gCost, int handle){
+    if ((entries.size() + 1) * 2 > slots.size()) {
+        grow();
+    }
+
+    StateEntry e = {key, gCost, handle};
+    entries.push_back(e);
+    int index = (int)entries.size() - 1;
+
+    size_t i = slotFor(key);
+    while (slots[i].stamp == generation) {
+        i = (i + 1) & mask;
+    }
+    slots[i].key = key;
+    slots[i].entry = index;
+    slots[i].stamp = generation;
+    return index;
+}
+
+// Doubles the slot array and re-inserts every entry; entry indices are unchanged.
+void StateTable::grow(){
+    Slot empty = {0, -1, 0};
+    slots.assign(slots.size() * 2, empty);
+    mask = slots.size() - 1;
+    generation = 1;
+
+    for (int index = 0; index < (int)entries.size(); index++) {
+        size_t i = slotFor(entries[index].key);
+        while (slots[i].stamp == generation) {
+            i = (i + 1) & mask;
+        }
+        slots[i].key = entries[index].key;
+        slots[i].entry = index;
+        slots[i].stamp = generation;
+    }
+}
@@ -0,0 +1,72 @@
+// File: statetable.h
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Open-addressing hash table of search states keyed on the packed board.
+
+#ifndef __STATETABLE_H__
+#define __STATETABLE_H__
+
+#include <vector>
+
+#include "board.h"
+
+using namespace std;
+
+// Per-state bookkeeping for the solvers: best cost found so far and where the state sits in the open list.
+struct StateEntry {
+    packedBoard key;
+    int gCost;  // Cheapest known cost to reach this state
+    int handle; // Index of the state's node in the open-list heap, or StateTable::CLOSED once expanded
+};
+
+// Linear-probing hash table. Probing only touches the compact slot array (key + entry index);
+// entries live in a dense vector so their indices stay valid while the table grows.
+class StateTable{
+
+private:
+
+    struct Slot {
+        packedBoard key;
+        int entry;      // Index into entries
+        unsigned stamp; // Slot is in use only if this equals the table's generation
+    };
+
+    vector<Slot> slots;
+    vector<StateEntry> entries;
+    size_t mask;
+    unsigned generation;
+    size_t recentUse; // States per search, a running maximum that decays by 1/8 per clear
+
+    size_t slotFor(packedBoard key) const;
+    void grow();
+
+public:
+
+    static const int CLOSED = -1;
+
+    StateTable(int expectedStates = 4096);
+
+    // Empties the table for the next search in constant time by starting a new slot generation, so a
+    // table reused across solves costs nothing to reset however large it grew. Capacity follows recent
+    // use: a run of large searches keeps it, while one large search among small ones is released a few
+    // clears later. The table never shrinks below retainStates.
+    void clear(int retainStates = 1 << 16);
+
+    // Returns: Entry index for key, or -1 if the state has not been seen
+    int find(packedBoard key) const;
+
+    // Adds a state that is not yet in the table.
+    // Returns: Entry index of the new state
+    int insert(packedBoard key, int gCost, int handle);
+
+    StateEntry &entry(int index){
+        return entries[index];
+    }
+
+    int size() const{
+        return (int)entries.size();
+    }
+
+};
+
+#endif
@@ -0,0 +1,139 @@
+// File: symmetry.cpp
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Implements symmetry canonicalization of puzzle queries and table states.
+
+#include <algorithm>
+
+#include "symmetry.h"
+
+using namespace std;
+
+packedBoard transposeBoard(packedBoard board, int width){
+    packedBoard result = 0;
+    for (int r = 0; r < width; r++) {
+        for (int c = 0; c < width; c++) {
+            result |= (packedBoard)tileAt(board, r * width + c) << (4 * (c * width + r));
+        }
+    }
+    return result;
+}
+
+packedBoard relabelToReference(packedBoard board, packedBoard reference, int width){
+    int cells = width * width;
+    int name[MAX_BOARD_CELLS];
+    int next = 1;
+    for (int i = 0; i < cells; i++) {
+        int t = tileAt(reference, i);
+        name[t] = (t == 0) ? 0 : next++;
+    }
+
+    packedBoard result = 0;
+    for (int i = 0; i < cells; i++) {
+        result |= (packedBoard)name[tileAt(board, i)] << (4 * i);
+    }
+    return result;
+}
+
+CanonicalQuery canonicalQuery(packedBoard start, packedBoard goal, int width){
+    CanonicalQuery best = {0, 0};
+    bool first = true;
+
+    for (int form = 0; form < 4; form++) {
+        bool transposed = (form & 1) != 0;
+        bool swapped = (form & 2) != 0;
+
+        packedBoard s = swapped ? goal : start;
+        packedBoard g = swapped ? start : goal;
+        if (transposed) {
+            s = transposeBoard(s, width);
+            g = transposeBoard(g, width);
+        }
+
+        CanonicalQuery q = {relabelToReference(s, g, width), relabelToReference(g, g, width)};
+        if (first || q < best) {
+            best = q;
+            first = false;
+        }
+    }
+    return best;
+}
+
+//////////////////////////////////////////////////////////////
+//Constructor: BoardSymmetry
+//Purpose: Builds the tile renaming that maps the transposed reference back onto the reference.
+// Params:
+//   - reference: Board that distances are measured against
+//   - w: Board width
+//////////////////////////////////////////////////////////////
+BoardSymmetry::BoardSymmetry(packedBoard reference, int w){
+    width = w;
+    int blank = blankCell(reference, width * width);
+    usable = (blank % width == blank / width);
+
+    bool present[MAX_BOARD_CELLS] = {false};
+    for (int i = 0; i < width * width; i++) {
+        usable = usable && !present[tileAt(reference, i)];
+        present[tileAt(reference, i)] = true;
+    }
+
+    packedBoard transposed = transposeBoard(reference, width);
+    for (int i = 0; i < width * width; i++) {
+        tileMap[tileAt(transposed, i)] = tileAt(reference, i);
+    }
+}
+
+packedBoard BoardSymmetry::mirror(packedBoard board){
+    if (!usable) {
+        return board;
+    }
+    packedBoard transposed = transposeBoard(board, width);
+    packedBoard result = 0;
+    for (int i = 0; i < width * width; i++) {
+        result |= (packedBoard)tileMap[tileAt(transposed, i)] << (4 * i);
+    }
+    return result;
+}
+
+packedBoard BoardSymmetry::canonical(packedBoard board){
+    return min(board, mirror(board));
+}
+
+//////////////////////////////////////////////////////////////
+//Constructor: SymmetricIndexer
+//Purpose: Marks the canonical member of every class and numbers the classes in rank order.
+// Params:
+//   - goal: Goal state string with distinct tiles; without a usable symmetry every state is its own class
+//////////////////////////////////////////////////////////////
+SymmetricIndexer::SymmetricIndexer(string const goal) : states(goal), symmetry(packBoard(goal), states.getWidth()){
+    long long total = states.size();
+    canonicalBits.assign((total + 63) / 64, 0);
+    classesBefore.assign(canonicalBits.size(), 0);
+
+    for (long long r = 0; r < total; r++) {
+        packedBoard board = states.unrank(r);
+        if (symmetry.canonical(board) == board) {
+            canonicalBits[r / 64] |= 1ULL << (r % 64);
+            representative.push_back(r);
+        }
+    }
+    for (size_t w = 1; w < canonicalBits.size(); w++) {
+        classesBefore[w] = classesBefore[w - 1] + __builtin_popcountll(canonicalBits[w - 1]);
+    }
+}
+
+long long SymmetricIndexer::rank(packedBoard board){
+    long long r = states.rank(symmetry.canonical(board));
+    unsigned long long below = canonicalBits[r / 64] & ((1ULL << (r % 64)) - 1);
+    return classesBefore[r / 64] + __builtin_popcountll(below);
+}
+
+packedBoard SymmetricIndexer::unrank(long long index){
+    return states.unrank(representative[index]);
+}
+
+int SymmetricIndexer::members(packedBoard board, packedBoard out[2]){
+    out[0] = symmetry.canonical(board);
+    out[1] = symmetry.mirror(out[0]);
+    return out[1] == out[0] ? 1 : 2;
+}
@@ -0,0 +1,117 @@
+// File: symmetry.h
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Maps puzzle queries and table states to a representative under the board's symmetries.
+
+#ifndef __SYMMETRY_H__
+#define __SYMMETRY_H__
+
+#include <string>
+#include <vector>
+
+#include "board.h"
+
+using namespace std;
+
+// Two symmetries are used:
+//   - Transpose: reflecting both boards in the main diagonal (then renaming tiles) preserves distances,
+//     with moves mapped L<->U and R<->D.
+//   - Reversal: moves are reversible, so start->goal is as long as goal->start.
+// Tile names never affect which moves are legal, so both boards are renamed relative to the target.
+
+// Returns: Board reflected in its main diagonal (cell (r, c) moves to (c, r))
+packedBoard transposeBoard(packedBoard board, int width);
+
+// Purpose: Renames tiles so reference becomes the standard goal with the same blank cell (tiles 1, 2, ...
+//          in reading order); board is renamed the same way.
+// Returns: Renamed board
+packedBoard relabelToReference(packedBoard board, packedBoard reference, int width);
+
+// A query rewritten into its representative form. It has the same optimal solution length as the original.
+struct CanonicalQuery {
+    packedBoard start;
+    packedBoard goal;
+
+    bool operator<(const CanonicalQuery& other) const {
+        return goal < other.goal || (goal == other.goal && start < other.start);
+    }
+};
+
+// Purpose: Picks the smallest of the four symmetric forms of (start, goal), compared by (goal, start).
+//          Every query in the same symmetry class gets the same representative, so solution-length caches
+//          keyed on it share entries across the class (see the generator's 4x4 verification).
+CanonicalQuery canonicalQuery(packedBoard start, packedBoard goal, int width);
+
+// Symmetry of states measured against one fixed reference (e.g. the goal of a distance table or PDB).
+// Available when every tile of the reference is distinct and its blank lies on the main diagonal: the
+// transpose, followed by the renaming that maps the transposed reference back onto itself, then preserves
+// distance to it. With repeated (don't-care) tiles that renaming is not a bijection in general.
+class BoardSymmetry{
+
+private:
+
+    int width;
+    bool usable;
+    int tileMap[MAX_BOARD_CELLS]; // Tile in the transposed reference -> tile in the same cell of the reference
+
+public:
+
+    BoardSymmetry(packedBoard reference, int w);
+
+    bool available(){
+        return usable;
+    }
+
+    // Returns: The symmetric image of board (board itself if no symmetry is available)
+    packedBoard mirror(packedBoard board);
+
+    // Returns: Representative of board's symmetry class, the smaller of board and its mirror
+    packedBoard canonical(packedBoard board);
+
+};
+
+// Dense index over BoardSymmetry classes of the states reachable from a goal with distinct tiles: each class
+// is represented by its canonical member and numbered in StateIndexer rank order. Used in place of
+// StateIndexer, a distance table holds one entry per class, roughly half as many (90792 for the 3x3 goal
+// 123456780 instead of 181440). Keeps a bitmap over all StateIndexer ranks, so only suitable for 3x3 tables.
+class SymmetricIndexer{
+
+private:
+
+    StateIndexer states;
+    BoardSymmetry symmetry;
+    vector<unsigned long long> canonicalBits; // Bit r set if StateIndexer rank r is its class's representative
+    vector<long long> classesBefore;          // Number of representatives in the words before each word
+    vector<long long> representative;         // Class index -> StateIndexer rank
+
+public:
+
+    SymmetricIndexer(string const goal);
+
+    bool available(){
+        return symmetry.available();
+    }
+
+    int getWidth(){
+        return states.getWidth();
+    }
+    int getCells(){
+        return states.getCells();
+    }
+
+    long long size(){
+        return (long long)representative.size();
+    }
+
+    // Returns: Index of board's class
+    long long rank(packedBoard board);
+
+    // Returns: The canonical member of the class
+    packedBoard unrank(long long index);
+
+    // Returns: The members of board's class (one or two boards)
+    int members(packedBoard board, packedBoard out[2]);
+
+};
+
+#endif
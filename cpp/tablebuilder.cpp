@@ -0,0 +1,154 @@
+// File: tablebuilder.cpp
+// Author: Johnny CW
+// Date: October 18, 2026
+// Description: Native tool that builds an exhaustive distance table (full puzzle or pattern database)
+//              with the multi-threaded breadth-first search in parallelbfs.h.
+//
+// Build: g++ -O2 -std=c++17 -pthread tablebuilder.cpp board.cpp symmetry.cpp -o tablebuilder
+//
+// Usage: tablebuilder [--goal STATE] [--threads N] [--out PREFIX] [--symmetric]
+//
+//   A goal without repeated characters builds the full table, indexed by StateIndexer (181440 entries for 3x3).
+//   With --symmetric the full table holds one entry per transpose-symmetry class instead, indexed by
+//   SymmetricIndexer (90792 entries for 123456780); the goal needs its blank on the main diagonal.
+//   Tiles written with a repeated character are don't-cares and the result is a pattern database indexed by
+//   PatternIndexer (e.g. "1234<<<<<<<<<<<0" tracks the blank and tiles 1-4 of the 15-puzzle).
+//
+// Output:
+//   PREFIX.dist   Packed distance array, little-endian:
+//                   char    magic[4]   "PZD1"
+//                   uint8   width
+//                   uint8   pattern    0 = StateIndexer ranks, 1 = PatternIndexer ranks, 2 = SymmetricIndexer ranks
+//                   uint8   reserved[2]
+//                   uint64  goal       packed board (see board.h)
+//                   uint64  size       number of entries
+//                   size x uint8       distance per rank, 0xFF if unreachable
+//   PREFIX.hist   One "depth count" line per depth (counts are per class with --symmetric)
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board.h"
+#include "parallelbfs.h"
+#include "symmetry.h"
+
+using namespace std;
+
+
+static void writeLE(ofstream &out, unsigned long long value, int bytes){
+    for (int i = 0; i < bytes; i++) {
+        out.put((char)((value >> (8 * i)) & 0xFF));
+    }
+}
+
+
+int main(int argc, char **argv){
+    string goal = "123456780";
+    string prefix = "distance";
+    int threads = (int)thread::hardware_concurrency();
+    bool symmetric = false;
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--symmetric") {
+            symmetric = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return 1;
+        }
+        if (arg == "--goal") {
+            goal = argv[++i];
+        } else if (arg == "--threads") {
+            threads = atoi(argv[++i]);
+        } else if (arg == "--out") {
+            prefix = argv[++i];
+        } else {
+            fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return 1;
+        }
+    }
+    if (!validPattern(goal)) {
+        fprintf(stderr, "Goal must be a 3x3 or 4x4 board with exactly one blank\n");
+        return 1;
+    }
+
+    // PatternIndexer writes a single don't-care value back into untracked cells, so only one character may repeat
+    bool pattern = false;
+    int repeated = 0;
+    for (size_t i = 0; i < goal.length(); i++) {
+        bool repeats = goal.find(goal[i], i + 1) != string::npos;
+        repeated += repeats && goal.find(goal[i]) == i;
+        pattern = pattern || repeats;
+    }
+    if (repeated > 1) {
+        fprintf(stderr, "Only one character may be repeated to mark don't-care tiles\n");
+        return 1;
+    }
+    if (symmetric && (pattern || goal.length() != 9 || !BoardSymmetry(packBoard(goal), 3).available())) {
+        fprintf(stderr, "--symmetric needs a 3x3 goal with distinct tiles and its blank on the main diagonal\n");
+        return 1;
+    }
+
+    chrono::steady_clock::time_point started = chrono::steady_clock::now();
+    packedBoard goalBoard = packBoard(goal);
+    vector<unsigned char> distance;
+    vector<long long> counts;
+    int width;
+
+    if (pattern) {
+        PatternIndexer indexer(goal);
+        width = indexer.getWidth();
+        counts = parallelDistanceTable(indexer, goalBoard, threads, distance);
+    } else if (symmetric) {
+        SymmetricIndexer indexer(goal);
+        width = indexer.getWidth();
+        counts = parallelDistanceTable(indexer, goalBoard, threads, distance);
+    } else {
+        StateIndexer indexer(goal);
+        width = indexer.getWidth();
+        if (indexer.size() > (1LL << 34)) {
+            fprintf(stderr, "The full 4x4 table is too large; mark don't-care tiles to build a pattern database\n");
+            return 1;
+        }
+        counts = parallelDistanceTable(indexer, goalBoard, threads, distance);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+    ofstream dist((prefix + ".dist").c_str(), ios::binary);
+    ofstream hist((prefix + ".hist").c_str());
+    if (!dist || !hist) {
+        fprintf(stderr, "Cannot open %s.dist / %s.hist for writing\n", prefix.c_str(), prefix.c_str());
+        return 1;
+    }
+
+    dist.write("PZD1", 4);
+    writeLE(dist, width, 1);
+    writeLE(dist, pattern ? 1 : (symmetric ? 2 : 0), 1);
+    writeLE(dist, 0, 2);
+    writeLE(dist, goalBoard, 8);
+    writeLE(dist, distance.size(), 8);
+    dist.write((const char *)distance.data(), distance.size());
+
+    long long total = 0;
+    for (size_t d = 0; d < counts.size(); d++) {
+        hist << d << " " << counts[d] << "\n";
+        total += counts[d];
+    }
+    dist.close();
+    hist.close();
+    if (dist.fail() || hist.fail()) {
+        fprintf(stderr, "Cannot write %s.dist / %s.hist\n", prefix.c_str(), prefix.c_str());
+        return 1;
+    }
+
+    fprintf(stderr, "%lld %s, max depth %d, %.2f s on %d threads\n", total, symmetric ? "classes" : "states",
+            (int)counts.size() - 1, seconds, threads);
+    return 0;
+}
@@ -69,9 +69,87 @@ char* solveAStar(const char* initialState, const char* goalState, int* stats, in
     return path;
 }
 
+// Purpose: Wrapper for the memory-lean frontier solver, returning path and updating stats.
+// Params:
+//   - initialState: Starting puzzle state (C-string, e.g., "123804765")
+//   - goalState: Target state (C-string, e.g., "123456780")
+//   - stats: Array to store [pathLength, numOfStateExpansions, maxQLength (peak states stored), actualRunningTime * 1000]
+//   - heuristic: 0 for misplaced tiles, 1 for Manhattan distance
+// Returns: Pointer to solution path string (allocated in WebAssembly memory)
+EMSCRIPTEN_KEEPALIVE
+char* solveFrontier(const char* initialState, const char* goalState, int* stats, int heuristic) {
+    int pathLength = 0, numOfStateExpansions = 0, maxQLength = 0;
+    float actualRunningTime = 0.0;
+    int numOfDeletions = 0, numOfLocalLoops = 0, numOfReExpansions = 0;
+
+    string result = frontier_bfhs(
+        string(initialState), string(goalState), pathLength, numOfStateExpansions,
+        maxQLength, actualRunningTime, numOfDeletions, numOfLocalLoops, numOfReExpansions,
+        heuristic == 0 ? misplacedTiles : manhattanDistance
+    );
+
+    stats[0] = pathLength;
+    stats[1] = numOfStateExpansions;
+    stats[2] = maxQLength;
+    stats[3] = static_cast<int>(actualRunningTime * 1000);
+
+    char* path = (char*)malloc(result.length() + 1);
+    strcpy(path, result.c_str());
+    return path;
+}
+
+// Purpose: Wrapper for the multi-goal Uniform Cost solver: one search answers every goal.
+// Params:
+//   - initialState: Starting puzzle state (C-string, e.g., "123804765")
+//   - goalStates: Comma-separated target states (C-string, e.g., "123456780,123456708")
+//   - stats: Array to store [goalsReached, numOfStateExpansions, maxQLength, actualRunningTime * 1000]
+//   - pathLengths: Array receiving one path length per goal, -1 if the goal is unreachable
+// Returns: Pointer to comma-separated solution paths in goal order (allocated in WebAssembly memory)
+EMSCRIPTEN_KEEPALIVE
+char* solveUCMultiGoal(const char* initialState, const char* goalStates, int* stats, int* pathLengths) {
+    int numOfStateExpansions = 0, maxQLength = 0;
+    float actualRunningTime = 0.0;
+
+    vector<string> goals;
+    string list(goalStates);
+    for (size_t start = 0; start <= list.length(); ) {
+        size_t end = list.find(',', start);
+        if (end == string::npos) {
+            end = list.length();
+        }
+        goals.push_back(list.substr(start, end - start));
+        start = end + 1;
+    }
+
+    vector<int> lengths;
+    vector<string> paths = uc_multiGoal(string(initialState), goals, lengths, numOfStateExpansions, maxQLength, actualRunningTime);
+
+    string result;
+    int goalsReached = 0;
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (i > 0) {
+            result += ",";
+        }
+        result += paths[i];
+        pathLengths[i] = lengths[i];
+        if (lengths[i] >= 0) {
+            goalsReached++;
+        }
+    }
+
+    stats[0] = goalsReached;
+    stats[1] = numOfStateExpansions;
+    stats[2] = maxQLength;
+    stats[3] = static_cast<int>(actualRunningTime * 1000);
+
+    char* path = (char*)malloc(result.length() + 1);
+    strcpy(path, result.c_str());
+    return path;
+}
+
 // Purpose: Frees memory allocated by solver functions to prevent leaks.
 // Params:
-//   - ptr: Pointer to memory allocated in solveUC or solveAStar
+//   - ptr: Pointer to memory allocated in solveUC, solveAStar, solveFrontier or solveUCMultiGoal
 EMSCRIPTEN_KEEPALIVE
 void freeMemory(char* ptr) {
     free(ptr);